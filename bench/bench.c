@@ -0,0 +1,647 @@
+#define _DEFAULT_SOURCE
+#define _POSIX_C_SOURCE 200809L
+
+#include "prim.h"
+#include "prim_dense.h"
+#include "boruvka.h"
+#include "kruskal.h"
+#include "mst_select.h"
+#include "generator.h"
+#include "thread_pool.h"
+#include "reorder.h"
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define MAX_LIST 16
+
+typedef enum BenchFamily {
+    FAMILY_ERDOS_RENYI,
+    FAMILY_GRID,
+    FAMILY_GEOMETRIC,
+    FAMILY_COMPLETE,
+    FAMILY_COUNT
+} BenchFamily;
+
+typedef struct BenchInput {
+    Graph* dense;
+    CSRGraph* csr;
+    int threads;
+} BenchInput;
+
+typedef struct BenchEngine {
+    const char* name;
+    bool dense;
+    MST_Result* (*run)(BenchInput* input);
+} BenchEngine;
+
+typedef struct BenchOptions {
+    bool families[FAMILY_COUNT];
+    int sizes[MAX_LIST];
+    int size_count;
+    double degrees[MAX_LIST];
+    int degree_count;
+    int runs;
+    int warmup;
+    int threads;
+    int max_weight;
+    int conversion_limit;
+    unsigned long long seed;
+    bool json;
+    const char* engines;
+} BenchOptions;
+
+static const char* family_names[FAMILY_COUNT] = { "erdos-renyi", "grid", "geometric", "complete" };
+
+static MST_Result* run_prim_heap(BenchInput* input) {
+    return prim_mst(input->dense, 0);
+}
+
+static MST_Result* run_prim_simple(BenchInput* input) {
+    return prim_mst_simple(input->dense, 0);
+}
+
+static MST_Result* run_dense_simd(BenchInput* input) {
+    return prim_mst_dense(input->dense, 0);
+}
+
+static MST_Result* run_dense_parallel(BenchInput* input) {
+    return prim_mst_dense_parallel(input->dense, 0, input->threads);
+}
+
+static MST_Result* run_dense_csr(BenchInput* input) {
+    return prim_mst_dense_csr(input->csr, 0);
+}
+
+static MST_Result* run_dense_parallel_csr(BenchInput* input) {
+    return prim_mst_dense_parallel_csr(input->csr, 0, input->threads);
+}
+
+static MST_Result* run_csr_binary(BenchInput* input) {
+    return prim_mst_csr_with_pq(input->csr, 0, PQ_BINARY_HEAP);
+}
+
+static MST_Result* run_csr_dary4(BenchInput* input) {
+    return prim_mst_csr_with_pq(input->csr, 0, PQ_DARY4_HEAP);
+}
+
+static MST_Result* run_csr_dary8(BenchInput* input) {
+    return prim_mst_csr_with_pq(input->csr, 0, PQ_DARY8_HEAP);
+}
+
+static MST_Result* run_csr_pairing(BenchInput* input) {
+    return prim_mst_csr_with_pq(input->csr, 0, PQ_PAIRING_HEAP);
+}
+
+static MST_Result* run_csr_bucket(BenchInput* input) {
+    return prim_mst_csr_with_pq(input->csr, 0, PQ_BUCKET_QUEUE);
+}
+
+static MST_Result* run_csr_bfs(BenchInput* input) {
+    return prim_mst_csr_reordered(input->csr, 0, ORDER_BFS);
+}
+
+static MST_Result* run_csr_rcm(BenchInput* input) {
+    return prim_mst_csr_reordered(input->csr, 0, ORDER_RCM);
+}
+
+static MST_Result* run_csr_degree(BenchInput* input) {
+    return prim_mst_csr_reordered(input->csr, 0, ORDER_DEGREE);
+}
+
+static MST_Result* run_boruvka(BenchInput* input) {
+    return boruvka_mst(input->csr, 0, input->threads);
+}
+
+static MST_Result* run_kruskal(BenchInput* input) {
+    return kruskal_mst(input->csr, 0);
+}
+
+static MST_Result* run_filter_kruskal(BenchInput* input) {
+    return filter_kruskal_mst(input->csr, 0);
+}
+
+static MST_Result* run_auto(BenchInput* input) {
+    return mst_auto(input->csr, 0, input->threads);
+}
+
+static const BenchEngine engines[] = {
+    { "prim-heap", true, run_prim_heap },
+    { "prim-simple", true, run_prim_simple },
+    { "dense-simd", true, run_dense_simd },
+    { "dense-parallel", true, run_dense_parallel },
+    { "dense-csr", false, run_dense_csr },
+    { "dense-parallel-csr", false, run_dense_parallel_csr },
+    { "csr-binary", false, run_csr_binary },
+    { "csr-dary4", false, run_csr_dary4 },
+    { "csr-dary8", false, run_csr_dary8 },
+    { "csr-pairing", false, run_csr_pairing },
+    { "csr-bucket", false, run_csr_bucket },
+    { "csr-bfs", false, run_csr_bfs },
+    { "csr-rcm", false, run_csr_rcm },
+    { "csr-degree", false, run_csr_degree },
+    { "kruskal", false, run_kruskal },
+    { "filter-kruskal", false, run_filter_kruskal },
+    { "boruvka", false, run_boruvka },
+    { "auto", false, run_auto }
+};
+
+static const int engine_count = (int)(sizeof(engines) / sizeof(engines[0]));
+
+static double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool write_all(int fd, const void* data, size_t size) {
+    const char* p = (const char*)data;
+    while (size > 0) {
+        ssize_t written = write(fd, p, size);
+        if (written <= 0) {
+            return false;
+        }
+        p += written;
+        size -= (size_t)written;
+    }
+    return true;
+}
+
+static bool read_all(int fd, void* data, size_t size) {
+    char* p = (char*)data;
+    while (size > 0) {
+        ssize_t got = read(fd, p, size);
+        if (got <= 0) {
+            return false;
+        }
+        p += got;
+        size -= (size_t)got;
+    }
+    return true;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile(const double* sorted, int count, double p) {
+    int rank = (int)ceil(p * count);
+    if (rank < 1) {
+        rank = 1;
+    }
+    return sorted[rank - 1];
+}
+
+static double median(const double* sorted, int count) {
+    if (count % 2 == 1) {
+        return sorted[count / 2];
+    }
+    return (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0;
+}
+
+static bool engine_selected(const BenchOptions* options, const char* name) {
+    if (!options->engines || strcmp(options->engines, "all") == 0) {
+        return true;
+    }
+
+    size_t length = strlen(name);
+    const char* p = options->engines;
+    while (*p) {
+        const char* end = strchr(p, ',');
+        size_t token = end ? (size_t)(end - p) : strlen(p);
+        if (token == length && strncmp(p, name, length) == 0) {
+            return true;
+        }
+        if (!end) {
+            break;
+        }
+        p = end + 1;
+    }
+    return false;
+}
+
+static int parse_list(const char* text, double* values, int limit) {
+    int count = 0;
+    const char* p = text;
+
+    while (*p && count < limit) {
+        char* end;
+        values[count++] = strtod(p, &end);
+        if (end == p) {
+            return -1;
+        }
+        if (*end != ',' && *end != '\0') {
+            return -1;
+        }
+        p = *end == ',' ? end + 1 : end;
+    }
+
+    return count;
+}
+
+static void print_usage(const char* program) {
+    printf("Usage: %s [options]\n", program);
+    printf("  --family LIST     erdos-renyi,grid,geometric,complete or all (default all)\n");
+    printf("  --sizes LIST      vertex counts, e.g. 1000,100000 (default 10000)\n");
+    printf("  --degrees LIST    average degrees for sparse families (default 8)\n");
+    printf("  --engines LIST    engine names or all (default all)\n");
+    printf("  --runs N          timed runs per engine (default 5)\n");
+    printf("  --warmup N        untimed warm-up runs per engine (default 1)\n");
+    printf("  --threads N       worker threads for parallel engines (default: CPUs)\n");
+    printf("  --max-weight N    largest edge weight (default 1000)\n");
+    printf("  --convert-limit N largest graph converted between dense and CSR (default 4096)\n");
+    printf("  --seed N          generator seed (default 42)\n");
+    printf("  --format csv|json output format (default csv)\n");
+    printf("Engines:");
+    for (int i = 0; i < engine_count; i++) {
+        printf(" %s", engines[i].name);
+    }
+    printf("\n");
+}
+
+static bool parse_families(const char* text, bool* families) {
+    for (int f = 0; f < FAMILY_COUNT; f++) {
+        families[f] = false;
+    }
+
+    if (strcmp(text, "all") == 0) {
+        for (int f = 0; f < FAMILY_COUNT; f++) {
+            families[f] = true;
+        }
+        return true;
+    }
+
+    const char* p = text;
+    while (*p) {
+        const char* end = strchr(p, ',');
+        size_t token = end ? (size_t)(end - p) : strlen(p);
+        bool found = false;
+
+        for (int f = 0; f < FAMILY_COUNT; f++) {
+            if (token == strlen(family_names[f]) && strncmp(p, family_names[f], token) == 0) {
+                families[f] = true;
+                found = true;
+            }
+        }
+
+        if (!found) {
+            return false;
+        }
+        if (!end) {
+            break;
+        }
+        p = end + 1;
+    }
+
+    return true;
+}
+
+static bool parse_options(int argc, char* argv[], BenchOptions* options) {
+    for (int f = 0; f < FAMILY_COUNT; f++) {
+        options->families[f] = true;
+    }
+    options->sizes[0] = 10000;
+    options->size_count = 1;
+    options->degrees[0] = 8.0;
+    options->degree_count = 1;
+    options->runs = 5;
+    options->warmup = 1;
+    options->threads = 0;
+    options->max_weight = 1000;
+    options->conversion_limit = 4096;
+    options->seed = 42;
+    options->json = false;
+    options->engines = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            print_usage(argv[0]);
+            exit(EXIT_SUCCESS);
+        }
+
+        if (!value) {
+            fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+        i++;
+
+        if (strcmp(arg, "--family") == 0) {
+            if (!parse_families(value, options->families)) {
+                fprintf(stderr, "Unknown graph family: %s\n", value);
+                return false;
+            }
+        } else if (strcmp(arg, "--sizes") == 0) {
+            double values[MAX_LIST];
+            options->size_count = parse_list(value, values, MAX_LIST);
+            if (options->size_count <= 0) {
+                fprintf(stderr, "Invalid size list: %s\n", value);
+                return false;
+            }
+            for (int k = 0; k < options->size_count; k++) {
+                if (values[k] < 1 || values[k] > INT_MAX) {
+                    fprintf(stderr, "Invalid size: %g\n", values[k]);
+                    return false;
+                }
+                options->sizes[k] = (int)values[k];
+            }
+        } else if (strcmp(arg, "--degrees") == 0) {
+            options->degree_count = parse_list(value, options->degrees, MAX_LIST);
+            if (options->degree_count <= 0) {
+                fprintf(stderr, "Invalid degree list: %s\n", value);
+                return false;
+            }
+        } else if (strcmp(arg, "--engines") == 0) {
+            options->engines = value;
+        } else if (strcmp(arg, "--runs") == 0) {
+            options->runs = atoi(value);
+        } else if (strcmp(arg, "--warmup") == 0) {
+            options->warmup = atoi(value);
+        } else if (strcmp(arg, "--threads") == 0) {
+            options->threads = atoi(value);
+        } else if (strcmp(arg, "--max-weight") == 0) {
+            options->max_weight = atoi(value);
+        } else if (strcmp(arg, "--convert-limit") == 0) {
+            options->conversion_limit = atoi(value);
+        } else if (strcmp(arg, "--seed") == 0) {
+            options->seed = strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--format") == 0) {
+            if (strcmp(value, "json") == 0) {
+                options->json = true;
+            } else if (strcmp(value, "csv") == 0) {
+                options->json = false;
+            } else {
+                fprintf(stderr, "Unknown output format: %s\n", value);
+                return false;
+            }
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options->runs <= 0 || options->warmup < 0) {
+        fprintf(stderr, "Runs must be positive and warm-up non-negative\n");
+        return false;
+    }
+
+    if (options->max_weight < 0 || options->max_weight >= INF) {
+        fprintf(stderr, "Invalid maximum weight\n");
+        return false;
+    }
+
+    if (options->threads <= 0) {
+        options->threads = thread_pool_default_size();
+    }
+
+    return true;
+}
+
+static int emitted_rows = 0;
+
+static void emit_header(const BenchOptions* options) {
+    if (options->json) {
+        printf("[\n");
+    } else {
+        printf("family,vertices,edges,degree,engine,threads,runs,median_ms,p95_ms,min_ms,"
+               "edges_per_sec,total_weight,peak_rss_kb\n");
+    }
+}
+
+static void emit_footer(const BenchOptions* options) {
+    if (options->json) {
+        printf("%s]\n", emitted_rows > 0 ? "\n" : "");
+    }
+}
+
+static long long time_engine(const BenchOptions* options, const BenchEngine* engine,
+                             BenchInput* input, double* times) {
+    for (int w = 0; w < options->warmup; w++) {
+        destroy_mst_result(engine->run(input));
+    }
+
+    long long total_weight = 0;
+    for (int r = 0; r < options->runs; r++) {
+        double start = now_seconds();
+        MST_Result* result = engine->run(input);
+        times[r] = now_seconds() - start;
+        total_weight = result->total_weight;
+        destroy_mst_result(result);
+    }
+
+    return total_weight;
+}
+
+static bool run_engine_isolated(const BenchOptions* options, const BenchEngine* engine,
+                                BenchInput* input, double* times, long long* total_weight,
+                                long* peak_rss) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return false;
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+
+    if (pid == 0) {
+        close(fds[0]);
+        long long weight = time_engine(options, engine, input, times);
+        bool sent = write_all(fds[1], &weight, sizeof(weight)) &&
+                    write_all(fds[1], times, options->runs * sizeof(double));
+        close(fds[1]);
+        _exit(sent ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    close(fds[1]);
+    bool received = read_all(fds[0], total_weight, sizeof(*total_weight)) &&
+                    read_all(fds[0], times, options->runs * sizeof(double));
+    close(fds[0]);
+
+    int status;
+    struct rusage usage;
+    if (wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != EXIT_SUCCESS || !received) {
+        fprintf(stderr, "Engine %s failed in its child process\n", engine->name);
+        exit(EXIT_FAILURE);
+    }
+
+    *peak_rss = usage.ru_maxrss;
+    return true;
+}
+
+static void emit_row(const BenchOptions* options, const char* family, int vertices,
+                     int edges, double degree, const BenchEngine* engine,
+                     const double* sorted, long long total_weight, long rss) {
+    double median_time = median(sorted, options->runs);
+    double p95_time = percentile(sorted, options->runs, 0.95);
+    double rate = median_time > 0.0 ? edges / median_time : 0.0;
+    int threads = strcmp(engine->name, "dense-parallel") == 0 ||
+                  strcmp(engine->name, "dense-parallel-csr") == 0 ||
+                  strcmp(engine->name, "boruvka") == 0 ||
+                  strcmp(engine->name, "auto") == 0 ? options->threads : 1;
+    if (options->json) {
+        printf("%s  {\"family\": \"%s\", \"vertices\": %d, \"edges\": %d, \"degree\": %.2f, "
+               "\"engine\": \"%s\", \"threads\": %d, \"runs\": %d, \"median_ms\": %.4f, "
+               "\"p95_ms\": %.4f, \"min_ms\": %.4f, \"edges_per_sec\": %.0f, "
+               "\"total_weight\": %lld, \"peak_rss_kb\": %ld}",
+               emitted_rows > 0 ? ",\n" : "", family, vertices, edges, degree, engine->name,
+               threads, options->runs, median_time * 1e3, p95_time * 1e3, sorted[0] * 1e3,
+               rate, total_weight, rss);
+    } else {
+        printf("%s,%d,%d,%.2f,%s,%d,%d,%.4f,%.4f,%.4f,%.0f,%lld,%ld\n",
+               family, vertices, edges, degree, engine->name, threads, options->runs,
+               median_time * 1e3, p95_time * 1e3, sorted[0] * 1e3, rate, total_weight, rss);
+    }
+
+    emitted_rows++;
+    fflush(stdout);
+}
+
+static bool bench_graph(const BenchOptions* options, BenchFamily family, BenchInput* input,
+                        double degree) {
+    int vertices = input->dense ? input->dense->vertices : input->csr->vertices;
+    int edges = input->csr ? input->csr->edges : 0;
+    double* times = (double*)safe_malloc(options->runs * sizeof(double));
+    long long reference = -1;
+    bool consistent = true;
+
+    if (!input->csr) {
+        for (int u = 0; u < vertices; u++) {
+            const int* row = graph_row(input->dense, u);
+            for (int v = u + 1; v < vertices; v++) {
+                edges += row[v] != INF;
+            }
+        }
+    }
+
+    for (int e = 0; e < engine_count; e++) {
+        const BenchEngine* engine = &engines[e];
+        if (!engine_selected(options, engine->name)) {
+            continue;
+        }
+
+        if ((engine->dense && !input->dense) || (!engine->dense && !input->csr)) {
+            fprintf(stderr, "Skipping %s on %s/%d: graph exceeds --convert-limit\n",
+                    engine->name, family_names[family], vertices);
+            continue;
+        }
+
+        long long total_weight;
+        long rss = -1;
+        if (!run_engine_isolated(options, engine, input, times, &total_weight, &rss)) {
+            total_weight = time_engine(options, engine, input, times);
+        }
+
+        if (reference < 0) {
+            reference = total_weight;
+        } else if (total_weight != reference) {
+            fprintf(stderr, "Weight mismatch on %s/%d: %s returned %lld, expected %lld\n",
+                    family_names[family], vertices, engine->name, total_weight, reference);
+            consistent = false;
+        }
+
+        qsort(times, options->runs, sizeof(double), compare_doubles);
+        emit_row(options, family_names[family], vertices, edges, degree,
+                 engine, times, total_weight, rss);
+    }
+
+    safe_free((void**)&times);
+    return consistent;
+}
+
+static BenchInput generate_input(const BenchOptions* options, BenchFamily family,
+                                 int vertices, double degree) {
+    BenchInput input = { NULL, NULL, options->threads };
+
+    switch (family) {
+        case FAMILY_ERDOS_RENYI:
+            input.csr = generate_erdos_renyi(vertices, degree, options->max_weight, options->seed);
+            break;
+        case FAMILY_GRID: {
+            int side = (int)sqrt((double)vertices);
+            if (side < 1) {
+                side = 1;
+            }
+            input.csr = generate_grid(side, (vertices + side - 1) / side, options->max_weight,
+                                      options->seed);
+            break;
+        }
+        case FAMILY_GEOMETRIC:
+            input.csr = generate_geometric(vertices, degree, options->max_weight, options->seed);
+            break;
+        default:
+            input.dense = generate_complete(vertices, options->max_weight, options->seed);
+            break;
+    }
+
+    if (input.csr && input.csr->vertices <= options->conversion_limit) {
+        input.dense = graph_from_csr(input.csr);
+    } else if (input.dense && input.dense->vertices <= options->conversion_limit) {
+        input.csr = csr_from_graph(input.dense);
+    }
+
+    return input;
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+
+    if (!parse_options(argc, argv, &options)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    bool consistent = true;
+    emit_header(&options);
+
+    for (int f = 0; f < FAMILY_COUNT; f++) {
+        if (!options.families[f]) {
+            continue;
+        }
+
+        BenchFamily family = (BenchFamily)f;
+        bool uses_degree = family == FAMILY_ERDOS_RENYI || family == FAMILY_GEOMETRIC;
+        int degree_count = uses_degree ? options.degree_count : 1;
+
+        for (int s = 0; s < options.size_count; s++) {
+            for (int d = 0; d < degree_count; d++) {
+                double degree = uses_degree ? options.degrees[d] : 0.0;
+                BenchInput input = generate_input(&options, family, options.sizes[s], degree);
+
+                if (family == FAMILY_GRID) {
+                    degree = 2.0 * input.csr->edges / input.csr->vertices;
+                } else if (family == FAMILY_COMPLETE) {
+                    degree = input.dense->vertices - 1;
+                }
+
+                if (!bench_graph(&options, family, &input, degree)) {
+                    consistent = false;
+                }
+
+                if (input.csr) {
+                    destroy_csr_graph(input.csr);
+                }
+                if (input.dense) {
+                    destroy_graph(input.dense);
+                }
+            }
+        }
+    }
+
+    emit_footer(&options);
+    return consistent ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
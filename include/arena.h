@@ -0,0 +1,15 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "utils.h"
+
+typedef struct Arena Arena;
+
+Arena* create_arena(size_t capacity);
+void* arena_alloc(Arena* arena, size_t size);
+void arena_reset(Arena* arena);
+size_t arena_capacity(Arena* arena);
+size_t arena_high_water(Arena* arena);
+void destroy_arena(Arena* arena);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,9 @@
+#ifndef BORUVKA_H
+#define BORUVKA_H
+
+#include "prim.h"
+
+MST_Result* boruvka_mst(CSRGraph* graph, int start_vertex, int thread_count);
+MST_Forest* boruvka_msf(CSRGraph* graph, int start_vertex, int thread_count);
+
+#endif
\ No newline at end of file
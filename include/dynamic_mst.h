@@ -0,0 +1,17 @@
+#ifndef DYNAMIC_MST_H
+#define DYNAMIC_MST_H
+
+#include "prim.h"
+
+typedef struct DynamicMST DynamicMST;
+
+bool mst_insert_edge(MST_Result* result, int u, int v, int weight);
+
+DynamicMST* create_dynamic_mst(Graph* graph, MST_Result* result);
+DynamicMST* create_dynamic_mst_csr(CSRGraph* graph, MST_Result* result);
+bool dynamic_mst_update_edge(DynamicMST* dynamic, int u, int v, int weight);
+bool dynamic_mst_delete_edge(DynamicMST* dynamic, int u, int v);
+int dynamic_mst_edge_weight(DynamicMST* dynamic, int u, int v);
+void destroy_dynamic_mst(DynamicMST* dynamic);
+
+#endif
\ No newline at end of file
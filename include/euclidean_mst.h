@@ -0,0 +1,20 @@
+#ifndef EUCLIDEAN_MST_H
+#define EUCLIDEAN_MST_H
+
+#include "prim_dense.h"
+#include "weighted_graph.h"
+
+#define KDTREE_MAX_DIMENSIONS 8
+#define KDTREE_LEAF_SIZE 16
+
+typedef double (*ImplicitWeightFn)(int u, int v, void* context);
+
+MST_Result_f64* implicit_mst(int vertices, ImplicitWeightFn weight, void* context,
+                             int start_vertex);
+MST_Result_f64* euclidean_mst(const float* points, int count, int dimensions, int start_vertex);
+MST_Result_f64* euclidean_mst_kernel(const float* points, int count, int dimensions,
+                                     int start_vertex, DenseKernel kernel);
+MST_Result_f64* euclidean_mst_kdtree(const float* points, int count, int dimensions,
+                                     int start_vertex);
+
+#endif
\ No newline at end of file
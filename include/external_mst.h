@@ -0,0 +1,42 @@
+#ifndef EXTERNAL_MST_H
+#define EXTERNAL_MST_H
+
+#include "prim.h"
+#include "graph_io.h"
+
+#define EXTERNAL_DEFAULT_MEMORY_BUDGET ((size_t)256 << 20)
+#define EXTERNAL_DEFAULT_IO_BUFFER ((size_t)1 << 20)
+#define EXTERNAL_MIN_IO_BUFFER ((size_t)4096)
+
+typedef struct ExternalEdge {
+    int32_t src;
+    int32_t dest;
+    int32_t weight;
+} ExternalEdge;
+
+typedef struct ExternalMSTConfig {
+    size_t memory_budget;
+    size_t io_buffer_size;
+    const char *temp_dir;
+} ExternalMSTConfig;
+
+typedef struct ExternalMSTStats {
+    int64_t edges_read;
+    int64_t edges_scanned;
+    int run_count;
+    int merge_passes;
+    uint64_t bytes_spilled;
+} ExternalMSTStats;
+
+typedef struct EdgeFileWriter EdgeFileWriter;
+
+ExternalMSTConfig default_external_config(void);
+EdgeFileWriter* create_edge_file(const char* path, int vertices, size_t buffer_size);
+bool edge_file_append(EdgeFileWriter* writer, int src, int dest, int weight);
+bool close_edge_file(EdgeFileWriter* writer);
+MST_Result* external_mst(const char* path, int start_vertex, const ExternalMSTConfig* config,
+                         ExternalMSTStats* stats);
+MST_Forest* external_msf(const char* path, int start_vertex, const ExternalMSTConfig* config,
+                         ExternalMSTStats* stats);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,13 @@
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include "graph.h"
+
+CSRGraph* generate_erdos_renyi(int vertices, double avg_degree, int max_weight,
+                               unsigned long long seed);
+CSRGraph* generate_grid(int rows, int cols, int max_weight, unsigned long long seed);
+CSRGraph* generate_geometric(int vertices, double avg_degree, int max_weight,
+                             unsigned long long seed);
+Graph* generate_complete(int vertices, int max_weight, unsigned long long seed);
+
+#endif
\ No newline at end of file
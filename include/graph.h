@@ -5,13 +5,44 @@
 
 typedef struct Graph {
     int vertices;
+    int max_weight;
+    int stride;
+    int *matrix;
     int **adj_matrix;
+    void *mapping;
+    size_t mapping_size;
 } Graph;
 
+typedef struct CSRGraph {
+    int vertices;
+    int edges;
+    int max_weight;
+    int *offsets;
+    int *neighbors;
+    int *weights;
+    void *mapping;
+    size_t mapping_size;
+} CSRGraph;
+
+static inline int* graph_row(const Graph* graph, int u) {
+    return graph->matrix + (size_t)u * graph->stride;
+}
+
+static inline int graph_weight(const Graph* graph, int u, int v) {
+    return graph->matrix[(size_t)u * graph->stride + v];
+}
+
 Graph* create_graph(int vertices);
-void add_edge(Graph* graph, int src, int dest, int weight);
+bool add_edge(Graph* graph, int src, int dest, int weight);
 void print_graph(Graph* graph);
 bool is_connected(Graph* graph);
 void destroy_graph(Graph* graph);
 
+CSRGraph* create_csr_graph(int vertices, int edge_count,
+                           const int* src, const int* dest, const int* weight);
+CSRGraph* csr_from_graph(Graph* graph);
+Graph* graph_from_csr(CSRGraph* csr);
+int csr_edge_weight(CSRGraph* graph, int src, int dest);
+void destroy_csr_graph(CSRGraph* graph);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef GRAPH_IO_H
+#define GRAPH_IO_H
+
+#include "graph.h"
+#include <stdint.h>
+
+#define GRAPH_FILE_MAGIC "PRIMGRF"
+#define GRAPH_FILE_VERSION 1
+#define GRAPH_FILE_ENDIAN_TAG 0x01020304u
+
+typedef enum GraphFileLayout {
+    GRAPH_FILE_INVALID = 0,
+    GRAPH_FILE_CSR = 1,
+    GRAPH_FILE_DENSE = 2,
+    GRAPH_FILE_EDGES = 3
+} GraphFileLayout;
+
+typedef enum EdgeListFormat {
+    EDGE_FORMAT_AUTO,
+    EDGE_FORMAT_DIMACS,
+    EDGE_FORMAT_SNAP,
+    EDGE_FORMAT_CSV
+} EdgeListFormat;
+
+typedef struct GraphFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t layout;
+    uint32_t endian_tag;
+    int32_t vertices;
+    int32_t edges;
+    int32_t max_weight;
+    int32_t stride;
+    uint32_t reserved0;
+    uint64_t file_size;
+    char reserved[16];
+} GraphFileHeader;
+
+bool save_graph_binary(const char* path, Graph* graph);
+bool save_csr_graph_binary(const char* path, CSRGraph* graph);
+GraphFileLayout probe_graph_file(const char* path);
+Graph* load_graph_binary(const char* path);
+Graph* load_graph_binary_verified(const char* path);
+CSRGraph* load_csr_graph_binary(const char* path);
+CSRGraph* load_csr_graph_binary_verified(const char* path);
+void unmap_graph_file(void* mapping, size_t size);
+
+EdgeListFormat detect_edge_list_format(const char* path, const char* data, size_t size);
+CSRGraph* parse_edge_list(const char* data, size_t size, EdgeListFormat format, int thread_count);
+CSRGraph* load_edge_list(const char* path, EdgeListFormat format, int thread_count);
+
+#endif
\ No newline at end of file
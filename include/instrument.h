@@ -0,0 +1,73 @@
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+#include "utils.h"
+#include <stdint.h>
+
+typedef enum InstrumentCounter {
+    INSTR_HEAP_INSERTS,
+    INSTR_HEAP_EXTRACTS,
+    INSTR_HEAP_SIFTS,
+    INSTR_DECREASE_KEYS,
+    INSTR_COMPARISONS,
+    INSTR_RELAX_SCANNED,
+    INSTR_RELAX_TAKEN,
+    INSTR_COUNTER_COUNT
+} InstrumentCounter;
+
+typedef enum InstrumentPhase {
+    INSTR_PHASE_SETUP,
+    INSTR_PHASE_SOLVE,
+    INSTR_PHASE_MERGE,
+    INSTR_PHASE_IO,
+    INSTR_PHASE_COUNT
+} InstrumentPhase;
+
+typedef struct InstrumentBlock {
+    uint64_t counters[INSTR_COUNTER_COUNT];
+    uint64_t phase_ns[INSTR_PHASE_COUNT];
+    struct InstrumentBlock *next;
+    int thread_index;
+} InstrumentBlock;
+
+typedef struct InstrumentTotals {
+    uint64_t counters[INSTR_COUNTER_COUNT];
+    uint64_t phase_ns[INSTR_PHASE_COUNT];
+    int threads;
+} InstrumentTotals;
+
+bool instrument_enabled(void);
+const char* instrument_counter_name(InstrumentCounter counter);
+const char* instrument_phase_name(InstrumentPhase phase);
+void instrument_totals(InstrumentTotals* totals);
+void instrument_reset(void);
+void instrument_dump_json(FILE* out);
+
+#ifdef PRIM_INSTRUMENT
+
+extern __thread InstrumentBlock* instrument_local;
+
+InstrumentBlock* instrument_register(void);
+uint64_t instrument_clock(void);
+
+static inline InstrumentBlock* instrument_block(void) {
+    InstrumentBlock* block = instrument_local;
+    return block ? block : instrument_register();
+}
+
+#define INSTR_ADD(counter, amount) (instrument_block()->counters[counter] += (uint64_t)(amount))
+#define INSTR_COUNT(counter) INSTR_ADD(counter, 1)
+#define INSTR_PHASE_BEGIN(phase) uint64_t instr_start_##phase = instrument_clock()
+#define INSTR_PHASE_END(phase) \
+    (instrument_block()->phase_ns[phase] += instrument_clock() - instr_start_##phase)
+
+#else
+
+#define INSTR_ADD(counter, amount) ((void)0)
+#define INSTR_COUNT(counter) ((void)0)
+#define INSTR_PHASE_BEGIN(phase) ((void)0)
+#define INSTR_PHASE_END(phase) ((void)0)
+
+#endif
+
+#endif
\ No newline at end of file
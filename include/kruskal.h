@@ -0,0 +1,32 @@
+#ifndef KRUSKAL_H
+#define KRUSKAL_H
+
+#include "prim.h"
+
+#ifndef FILTER_KRUSKAL_BASE
+#define FILTER_KRUSKAL_BASE 8192
+#endif
+
+typedef struct KruskalEdge {
+    int src;
+    int dest;
+    int weight;
+} KruskalEdge;
+
+typedef struct UnionFind {
+    int *parent;
+    int *rank;
+    int size;
+    int sets;
+} UnionFind;
+
+UnionFind* create_union_find(int size);
+int union_find_find(UnionFind* uf, int x);
+bool union_find_union(UnionFind* uf, int a, int b);
+void destroy_union_find(UnionFind* uf);
+
+void sort_kruskal_edges(KruskalEdge* edges, int count, int max_weight);
+MST_Result* kruskal_mst(CSRGraph* graph, int start_vertex);
+MST_Result* filter_kruskal_mst(CSRGraph* graph, int start_vertex);
+
+#endif
\ No newline at end of file
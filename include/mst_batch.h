@@ -0,0 +1,9 @@
+#ifndef MST_BATCH_H
+#define MST_BATCH_H
+
+#include "prim.h"
+
+MST_Result* prim_mst_batch(Graph** graphs, int count, int thread_count, int* components);
+void destroy_mst_batch(MST_Result* results, int count);
+
+#endif
\ No newline at end of file
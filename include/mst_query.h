@@ -0,0 +1,41 @@
+#ifndef MST_QUERY_H
+#define MST_QUERY_H
+
+#include "prim.h"
+
+#define PATH_BLOCK_SHIFT 5
+#define PATH_BLOCK_SIZE (1 << PATH_BLOCK_SHIFT)
+
+#ifndef PATH_BATCH_PARALLEL_MIN
+#define PATH_BATCH_PARALLEL_MIN 65536
+#endif
+
+typedef struct PathNode {
+    int head;
+    int jump;
+    int head_depth;
+    int prefix_max;
+} PathNode;
+
+typedef struct MSTPathIndex {
+    int vertex_count;
+    int block_count;
+    int level_count;
+    int *position;
+    int *vertex_at;
+    PathNode *nodes;
+    int *key;
+    int *block_prefix;
+    int *block_suffix;
+    int *block_table;
+} MSTPathIndex;
+
+MSTPathIndex* create_mst_path_index(MST_Result* result);
+int mst_path_lca(MSTPathIndex* index, int a, int b);
+int mst_path_max(MSTPathIndex* index, int a, int b);
+bool mst_path_improves(MSTPathIndex* index, int a, int b, int weight);
+void mst_path_max_batch(MSTPathIndex* index, const int* src, const int* dest, int count,
+                        int* out, int thread_count);
+void destroy_mst_path_index(MSTPathIndex* index);
+
+#endif
\ No newline at end of file
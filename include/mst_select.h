@@ -0,0 +1,52 @@
+#ifndef MST_SELECT_H
+#define MST_SELECT_H
+
+#include "prim.h"
+
+#ifndef MST_KRUSKAL_MAX_DEGREE
+#define MST_KRUSKAL_MAX_DEGREE 16
+#endif
+
+#ifndef MST_FILTER_KRUSKAL_MAX_DEGREE
+#define MST_FILTER_KRUSKAL_MAX_DEGREE 32
+#endif
+
+#ifndef MST_LARGE_GRAPH_VERTICES
+#define MST_LARGE_GRAPH_VERTICES 65536
+#endif
+
+#ifndef MST_BORUVKA_MIN_THREADS
+#define MST_BORUVKA_MIN_THREADS 8
+#endif
+
+#ifndef MST_BORUVKA_MIN_EDGES
+#define MST_BORUVKA_MIN_EDGES (1 << 20)
+#endif
+
+#ifndef MST_DENSE_EDGE_FACTOR
+#define MST_DENSE_EDGE_FACTOR 4
+#endif
+
+#ifndef MST_DENSE_PARALLEL_MIN_VERTICES
+#define MST_DENSE_PARALLEL_MIN_VERTICES 4096
+#endif
+
+typedef enum MSTEngine {
+    MST_ENGINE_DENSE_PRIM,
+    MST_ENGINE_DENSE_PARALLEL_PRIM,
+    MST_ENGINE_HEAP_PRIM,
+    MST_ENGINE_BUCKET_PRIM,
+    MST_ENGINE_KRUSKAL,
+    MST_ENGINE_FILTER_KRUSKAL,
+    MST_ENGINE_BORUVKA
+} MSTEngine;
+
+MSTEngine mst_select_engine(int vertices, long long edges, int max_weight, int thread_count,
+                            bool dense_input);
+MST_Result* mst_run_engine(CSRGraph* graph, int start_vertex, MSTEngine engine, int thread_count);
+MST_Result* mst_auto(CSRGraph* graph, int start_vertex, int thread_count);
+MST_Result* mst_run_engine_dense(Graph* graph, int start_vertex, MSTEngine engine, int thread_count);
+MST_Result* mst_auto_dense(Graph* graph, int start_vertex, int thread_count);
+const char* mst_engine_name(MSTEngine engine);
+
+#endif
\ No newline at end of file
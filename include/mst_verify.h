@@ -0,0 +1,9 @@
+#ifndef MST_VERIFY_H
+#define MST_VERIFY_H
+
+#include "prim.h"
+
+bool verify_mst(Graph* graph, MST_Result* result);
+bool verify_mst_csr(CSRGraph* graph, MST_Result* result);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,21 @@
+#ifndef MST_WORKSPACE_H
+#define MST_WORKSPACE_H
+
+#include "prim.h"
+#include "arena.h"
+
+typedef struct MSTWorkspace MSTWorkspace;
+
+MSTWorkspace* create_mst_workspace(int vertices);
+Arena* mst_workspace_arena(MSTWorkspace* workspace);
+PriorityQueue* mst_workspace_queue(MSTWorkspace* workspace, int vertices,
+                                   PQBackend backend, int max_key);
+void mst_workspace_reset(MSTWorkspace* workspace);
+void destroy_mst_workspace(MSTWorkspace* workspace);
+
+void prim_mst_into(MSTWorkspace* workspace, Graph* graph, int start_vertex, MST_Result* result);
+int prim_msf_into(MSTWorkspace* workspace, Graph* graph, int start_vertex, MST_Result* result);
+void prim_mst_csr_into(MSTWorkspace* workspace, CSRGraph* graph, int start_vertex,
+                       MST_Result* result);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef PQ_BACKEND_H
+#define PQ_BACKEND_H
+
+#include "priority_queue.h"
+#include "instrument.h"
+
+typedef struct PQOps {
+    void (*init)(PriorityQueue* pq);
+    void (*insert)(PriorityQueue* pq, int vertex, int key);
+    int (*extract_min)(PriorityQueue* pq);
+    void (*decrease_key)(PriorityQueue* pq, int vertex, int new_key);
+    void (*release)(PriorityQueue* pq);
+} PQOps;
+
+extern const PQOps pq_binary_ops;
+extern const PQOps pq_dary4_ops;
+extern const PQOps pq_dary8_ops;
+extern const PQOps pq_pairing_ops;
+extern const PQOps pq_bucket_ops;
+
+static inline void pq_push(PriorityQueue* pq, int vertex, int key) {
+    pq->ops->insert(pq, vertex, key);
+    INSTR_COUNT(INSTR_HEAP_INSERTS);
+}
+
+static inline int pq_pop_min(PriorityQueue* pq) {
+    INSTR_COUNT(INSTR_HEAP_EXTRACTS);
+    return pq->ops->extract_min(pq);
+}
+
+static inline void pq_lower_key(PriorityQueue* pq, int vertex, int new_key) {
+    pq->ops->decrease_key(pq, vertex, new_key);
+    INSTR_COUNT(INSTR_DECREASE_KEYS);
+}
+
+static inline bool pq_contains(const PriorityQueue* pq, int vertex) {
+    return pq->pos[vertex] != -1;
+}
+
+#endif
\ No newline at end of file
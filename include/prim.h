@@ -7,14 +7,34 @@
 typedef struct MST_Result {
     int *parent;
     int *key;
-    int total_weight;
+    long long total_weight;
     int vertex_count;
 } MST_Result;
 
+typedef struct MST_Forest {
+    MST_Result *tree;
+    int *component;
+    int *root;
+    long long *component_weight;
+    int component_count;
+} MST_Forest;
+
+MST_Result* create_mst_result(int vertices);
+MST_Result* mst_result_from_edges(int vertices, int root, int edge_count,
+                                  const int* src, const int* dest, const int* weight);
+MST_Forest* mst_forest_from_edges(int vertices, int root, int edge_count,
+                                  const int* src, const int* dest, const int* weight);
 MST_Result* prim_mst(Graph* graph, int start_vertex);
+MST_Result* prim_mst_with_pq(Graph* graph, int start_vertex, PQBackend backend);
 MST_Result* prim_mst_simple(Graph* graph, int start_vertex);
+MST_Result* prim_mst_csr(CSRGraph* graph, int start_vertex);
+MST_Result* prim_mst_csr_with_pq(CSRGraph* graph, int start_vertex, PQBackend backend);
+MST_Forest* prim_msf(Graph* graph, int start_vertex);
+MST_Forest* prim_msf_csr(CSRGraph* graph, int start_vertex);
 void print_mst(MST_Result* result);
 bool validate_mst(Graph* graph, MST_Result* result);
+bool validate_mst_csr(CSRGraph* graph, MST_Result* result);
 void destroy_mst_result(MST_Result* result);
+void destroy_mst_forest(MST_Forest* forest);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,23 @@
+#ifndef PRIM_DENSE_H
+#define PRIM_DENSE_H
+
+#include "prim.h"
+
+typedef enum DenseKernel {
+    DENSE_KERNEL_AUTO,
+    DENSE_KERNEL_SCALAR,
+    DENSE_KERNEL_SSE2,
+    DENSE_KERNEL_AVX2
+} DenseKernel;
+
+DenseKernel dense_kernel_detect(void);
+bool dense_kernel_supported(DenseKernel kernel);
+const char* dense_kernel_name(DenseKernel kernel);
+
+MST_Result* prim_mst_dense(Graph* graph, int start_vertex);
+MST_Result* prim_mst_dense_kernel(Graph* graph, int start_vertex, DenseKernel kernel);
+MST_Result* prim_mst_dense_parallel(Graph* graph, int start_vertex, int thread_count);
+MST_Result* prim_mst_dense_csr(CSRGraph* graph, int start_vertex);
+MST_Result* prim_mst_dense_parallel_csr(CSRGraph* graph, int start_vertex, int thread_count);
+
+#endif
\ No newline at end of file
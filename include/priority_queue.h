@@ -3,20 +3,57 @@
 
 #include "utils.h"
 
+typedef enum PQBackend {
+    PQ_BINARY_HEAP,
+    PQ_DARY4_HEAP,
+    PQ_DARY8_HEAP,
+    PQ_PAIRING_HEAP,
+    PQ_BUCKET_QUEUE
+} PQBackend;
+
+#ifndef PQ_DEFAULT_BACKEND
+#define PQ_DEFAULT_BACKEND PQ_BINARY_HEAP
+#endif
+
+#ifndef PQ_BUCKET_THRESHOLD
+#define PQ_BUCKET_THRESHOLD 4096
+#endif
+
+typedef enum PQStatus {
+    PQ_OK = 0,
+    PQ_ERR_NULL,
+    PQ_ERR_RANGE,
+    PQ_ERR_FULL,
+    PQ_ERR_PRESENT,
+    PQ_ERR_ABSENT,
+    PQ_ERR_KEY
+} PQStatus;
+
+struct PQOps;
+
 typedef struct PriorityQueue {
+    const struct PQOps *ops;
+    PQBackend backend;
     int *heap;
     int *pos;
     int *key;
     int size;
     int capacity;
+    int max_key;
+    void *impl;
 } PriorityQueue;
 
 PriorityQueue* create_pq(int max_size);
-void insert_pq(PriorityQueue* pq, int vertex, int key);
+PriorityQueue* create_pq_backend(int max_size, PQBackend backend);
+PriorityQueue* create_pq_bounded(int max_size, PQBackend backend, int max_key);
+PQBackend pq_select_backend(int max_key);
+PQStatus insert_pq(PriorityQueue* pq, int vertex, int key);
 int extract_min(PriorityQueue* pq);
-void decrease_key(PriorityQueue* pq, int vertex, int new_key);
+PQStatus decrease_key(PriorityQueue* pq, int vertex, int new_key);
 bool is_empty_pq(PriorityQueue* pq);
 bool is_in_pq(PriorityQueue* pq, int vertex);
+const char* pq_backend_name(PQBackend backend);
+const char* pq_status_name(PQStatus status);
 void destroy_pq(PriorityQueue* pq);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,20 @@
+#ifndef REORDER_H
+#define REORDER_H
+
+#include "prim.h"
+
+typedef enum VertexOrder {
+    ORDER_IDENTITY,
+    ORDER_BFS,
+    ORDER_RCM,
+    ORDER_DEGREE
+} VertexOrder;
+
+int* compute_vertex_order(CSRGraph* graph, VertexOrder order, int start_vertex);
+int* invert_vertex_order(const int* order, int vertices);
+CSRGraph* permute_csr_graph(CSRGraph* graph, const int* order);
+MST_Result* unpermute_mst_result(MST_Result* result, const int* order);
+MST_Result* prim_mst_csr_reordered(CSRGraph* graph, int start_vertex, VertexOrder order);
+const char* vertex_order_name(VertexOrder order);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,17 @@
+#ifndef STREAMING_MST_H
+#define STREAMING_MST_H
+
+#include "prim.h"
+
+typedef struct StreamingMST StreamingMST;
+
+StreamingMST* create_streaming_mst(int vertices);
+bool streaming_mst_add_edge(StreamingMST* stream, int u, int v, int weight);
+int streaming_mst_edge_count(StreamingMST* stream);
+long long streaming_mst_weight(StreamingMST* stream);
+long long streaming_mst_edges_seen(StreamingMST* stream);
+MST_Result* streaming_mst_snapshot(StreamingMST* stream, int root);
+MST_Forest* streaming_msf_snapshot(StreamingMST* stream, int root);
+void destroy_streaming_mst(StreamingMST* stream);
+
+#endif
\ No newline at end of file
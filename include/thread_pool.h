@@ -0,0 +1,25 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include "utils.h"
+
+typedef struct ThreadPool ThreadPool;
+
+typedef void (*ThreadTask)(void* arg, int thread_id, int thread_count);
+
+ThreadPool* create_thread_pool(int thread_count);
+int thread_pool_size(ThreadPool* pool);
+int thread_pool_default_size(void);
+void thread_pool_run(ThreadPool* pool, ThreadTask task, void* arg);
+void thread_pool_barrier(ThreadPool* pool, int thread_id);
+void destroy_thread_pool(ThreadPool* pool);
+
+static inline void thread_chunk(int total, int thread_id, int thread_count,
+                                int* begin, int* end) {
+    long long lo = (long long)total * thread_id / thread_count;
+    long long hi = (long long)total * (thread_id + 1) / thread_count;
+    *begin = (int)lo;
+    *end = (int)hi;
+}
+
+#endif
\ No newline at end of file
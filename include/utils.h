@@ -5,12 +5,22 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <stdarg.h>
+#include <limits.h>
 
 #define INF 999999
+#define CACHE_LINE_SIZE 64
 
 void* safe_malloc(size_t size);
+void* safe_aligned_malloc(size_t alignment, size_t size);
+void* safe_realloc(void* ptr, size_t size);
 void safe_free(void **ptr);
 void error_exit(const char* message);
-void debug_print(const char* format, ...);
+void debug_trace(const char* format, ...);
+
+#ifdef DEBUG
+#define debug_print(...) debug_trace(__VA_ARGS__)
+#else
+#define debug_print(...) ((void)sizeof(printf(__VA_ARGS__)))
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef WEIGHTED_GRAPH_H
+#define WEIGHTED_GRAPH_H
+
+#include "utils.h"
+#include <stdint.h>
+#include <math.h>
+
+#define WEIGHT_NONE_u8 UINT8_MAX
+#define WEIGHT_NONE_u16 UINT16_MAX
+#define WEIGHT_NONE_i32 INT32_MAX
+#define WEIGHT_NONE_i64 INT64_MAX
+#define WEIGHT_NONE_f32 ((float)INFINITY)
+#define WEIGHT_NONE_f64 ((double)INFINITY)
+
+#define WEIGHT_TYPES(X) \
+    X(u8, uint8_t, int64_t) \
+    X(u16, uint16_t, int64_t) \
+    X(i32, int32_t, int64_t) \
+    X(i64, int64_t, int64_t) \
+    X(f32, float, double) \
+    X(f64, double, double)
+
+#define DECLARE_WEIGHTED_GRAPH(S, T, A) \
+    typedef struct Graph_##S { \
+        int vertices; \
+        int stride; \
+        T max_weight; \
+        T *matrix; \
+    } Graph_##S; \
+    \
+    typedef struct CSRGraph_##S { \
+        int vertices; \
+        int edges; \
+        int *offsets; \
+        int *neighbors; \
+        T *weights; \
+    } CSRGraph_##S; \
+    \
+    typedef struct MST_Result_##S { \
+        int *parent; \
+        T *key; \
+        A total_weight; \
+        int vertex_count; \
+    } MST_Result_##S; \
+    \
+    static inline T* graph_row_##S(const Graph_##S* graph, int u) { \
+        return graph->matrix + (size_t)u * graph->stride; \
+    } \
+    \
+    Graph_##S* create_graph_##S(int vertices); \
+    bool add_edge_##S(Graph_##S* graph, int src, int dest, T weight); \
+    void destroy_graph_##S(Graph_##S* graph); \
+    CSRGraph_##S* create_csr_graph_##S(int vertices, int edge_count, const int* src, \
+                                       const int* dest, const T* weight); \
+    void destroy_csr_graph_##S(CSRGraph_##S* graph); \
+    MST_Result_##S* prim_mst_##S(Graph_##S* graph, int start_vertex); \
+    MST_Result_##S* prim_mst_csr_##S(CSRGraph_##S* graph, int start_vertex); \
+    void destroy_mst_result_##S(MST_Result_##S* result);
+
+WEIGHT_TYPES(DECLARE_WEIGHTED_GRAPH)
+
+#endif
\ No newline at end of file
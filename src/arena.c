@@ -0,0 +1,113 @@
+#include "arena.h"
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;
+    char *data;
+    size_t capacity;
+    size_t used;
+} ArenaBlock;
+
+struct Arena {
+    ArenaBlock *head;
+    size_t capacity;
+    size_t used;
+    size_t high_water;
+};
+
+static ArenaBlock* create_block(size_t capacity, ArenaBlock* next) {
+    ArenaBlock* block = (ArenaBlock*)safe_malloc(sizeof(ArenaBlock));
+
+    block->next = next;
+    block->data = (char*)safe_aligned_malloc(CACHE_LINE_SIZE, capacity);
+    block->capacity = capacity;
+    block->used = 0;
+
+    return block;
+}
+
+static void free_blocks(ArenaBlock* block) {
+    while (block) {
+        ArenaBlock* next = block->next;
+        safe_free((void**)&block->data);
+        safe_free((void**)&block);
+        block = next;
+    }
+}
+
+static size_t align_size(size_t size) {
+    return (size + CACHE_LINE_SIZE - 1) & ~(size_t)(CACHE_LINE_SIZE - 1);
+}
+
+Arena* create_arena(size_t capacity) {
+    Arena* arena = (Arena*)safe_malloc(sizeof(Arena));
+
+    capacity = align_size(capacity > 0 ? capacity : CACHE_LINE_SIZE);
+    arena->head = create_block(capacity, NULL);
+    arena->capacity = capacity;
+    arena->used = 0;
+    arena->high_water = 0;
+
+    debug_print("Created arena with %zu bytes", capacity);
+    return arena;
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+    if (!arena) {
+        error_exit("Arena is NULL");
+    }
+
+    size = align_size(size > 0 ? size : 1);
+    ArenaBlock* block = arena->head;
+
+    if (block->capacity - block->used < size) {
+        size_t capacity = arena->capacity > size ? arena->capacity : size;
+        block = create_block(capacity, arena->head);
+        arena->head = block;
+        arena->capacity += capacity;
+
+        debug_print("Arena grew by %zu bytes to %zu", capacity, arena->capacity);
+    }
+
+    void* ptr = block->data + block->used;
+    block->used += size;
+    arena->used += size;
+
+    if (arena->used > arena->high_water) {
+        arena->high_water = arena->used;
+    }
+
+    return ptr;
+}
+
+void arena_reset(Arena* arena) {
+    if (!arena) {
+        error_exit("Arena is NULL");
+    }
+
+    if (arena->head->next) {
+        free_blocks(arena->head);
+        arena->capacity = align_size(arena->high_water);
+        arena->head = create_block(arena->capacity, NULL);
+        debug_print("Arena coalesced into %zu bytes", arena->capacity);
+    }
+
+    arena->head->used = 0;
+    arena->used = 0;
+}
+
+size_t arena_capacity(Arena* arena) {
+    return arena ? arena->capacity : 0;
+}
+
+size_t arena_high_water(Arena* arena) {
+    return arena ? arena->high_water : 0;
+}
+
+void destroy_arena(Arena* arena) {
+    if (!arena) {
+        return;
+    }
+
+    free_blocks(arena->head);
+    safe_free((void**)&arena);
+}
\ No newline at end of file
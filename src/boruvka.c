@@ -0,0 +1,306 @@
+#include "boruvka.h"
+#include "instrument.h"
+#include "thread_pool.h"
+
+#define NO_EDGE (~0ULL)
+
+typedef struct BoruvkaState {
+    CSRGraph *graph;
+    int edge_count;
+    int *src;
+    int *dest;
+    int *weight;
+    int *live;
+    int *live_begin;
+    int *live_end;
+    int *component;
+    unsigned long long *best;
+    bool *in_tree;
+    int merged;
+} BoruvkaState;
+
+static int uf_find(int* component, int x) {
+    while (true) {
+        int parent = __atomic_load_n(&component[x], __ATOMIC_ACQUIRE);
+        if (parent == x) {
+            return x;
+        }
+
+        int grandparent = __atomic_load_n(&component[parent], __ATOMIC_ACQUIRE);
+        if (parent != grandparent) {
+            int expected = parent;
+            __atomic_compare_exchange_n(&component[x], &expected, grandparent, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+        }
+        x = grandparent;
+    }
+}
+
+static bool uf_union(int* component, int a, int b) {
+    while (true) {
+        a = uf_find(component, a);
+        b = uf_find(component, b);
+        if (a == b) {
+            return false;
+        }
+
+        if (a < b) {
+            int temp = a;
+            a = b;
+            b = temp;
+        }
+
+        int expected = a;
+        if (__atomic_compare_exchange_n(&component[a], &expected, b, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            return true;
+        }
+    }
+}
+
+static void atomic_min_u64(unsigned long long* target, unsigned long long value) {
+    unsigned long long current = __atomic_load_n(target, __ATOMIC_RELAXED);
+    while (value < current) {
+        if (__atomic_compare_exchange_n(target, &current, value, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            return;
+        }
+    }
+}
+
+static void count_edges_task(void* arg, int thread_id, int thread_count) {
+    BoruvkaState* state = (BoruvkaState*)arg;
+    CSRGraph* graph = state->graph;
+    int begin, end;
+    thread_chunk(graph->vertices, thread_id, thread_count, &begin, &end);
+
+    int count = 0;
+    for (int u = begin; u < end; u++) {
+        for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            if (graph->neighbors[e] > u) {
+                count++;
+            }
+        }
+    }
+    state->live_begin[thread_id] = count;
+}
+
+static void fill_edges_task(void* arg, int thread_id, int thread_count) {
+    BoruvkaState* state = (BoruvkaState*)arg;
+    CSRGraph* graph = state->graph;
+    int begin, end;
+    thread_chunk(graph->vertices, thread_id, thread_count, &begin, &end);
+
+    int next = state->live_begin[thread_id];
+    for (int u = begin; u < end; u++) {
+        for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            if (graph->neighbors[e] > u) {
+                state->src[next] = u;
+                state->dest[next] = graph->neighbors[e];
+                state->weight[next] = graph->weights[e];
+                state->live[next] = next;
+                state->in_tree[next] = false;
+                next++;
+            }
+        }
+    }
+
+    for (int v = begin; v < end; v++) {
+        state->component[v] = v;
+        state->best[v] = NO_EDGE;
+    }
+}
+
+static void find_min_edges_task(void* arg, int thread_id, int thread_count) {
+    BoruvkaState* state = (BoruvkaState*)arg;
+    (void)thread_count;
+
+    int write = state->live_begin[thread_id];
+    for (int i = state->live_begin[thread_id]; i < state->live_end[thread_id]; i++) {
+        int e = state->live[i];
+        int ru = uf_find(state->component, state->src[e]);
+        int rv = uf_find(state->component, state->dest[e]);
+
+        if (ru == rv) {
+            continue;
+        }
+
+        state->live[write++] = e;
+
+        unsigned long long key = ((unsigned long long)(unsigned)state->weight[e] << 32) | (unsigned)e;
+        atomic_min_u64(&state->best[ru], key);
+        atomic_min_u64(&state->best[rv], key);
+    }
+    INSTR_ADD(INSTR_RELAX_SCANNED, state->live_end[thread_id] - state->live_begin[thread_id]);
+    INSTR_ADD(INSTR_RELAX_TAKEN, write - state->live_begin[thread_id]);
+    state->live_end[thread_id] = write;
+}
+
+static void contract_task(void* arg, int thread_id, int thread_count) {
+    BoruvkaState* state = (BoruvkaState*)arg;
+    int begin, end;
+    thread_chunk(state->graph->vertices, thread_id, thread_count, &begin, &end);
+
+    int merged = 0;
+    for (int c = begin; c < end; c++) {
+        unsigned long long key = state->best[c];
+        if (key == NO_EDGE) {
+            continue;
+        }
+
+        state->best[c] = NO_EDGE;
+        int e = (int)(key & 0xffffffffULL);
+        if (uf_union(state->component, state->src[e], state->dest[e])) {
+            state->in_tree[e] = true;
+            merged++;
+        }
+    }
+
+    __atomic_fetch_add(&state->merged, merged, __ATOMIC_RELAXED);
+}
+
+static int collect_tree_edges(CSRGraph* graph, int thread_count,
+                              int** tree_src, int** tree_dest, int** tree_weight) {
+    ThreadPool* pool = create_thread_pool(thread_count);
+    thread_count = thread_pool_size(pool);
+
+    int vertices = graph->vertices;
+    int slots = graph->edges > 0 ? graph->edges : 1;
+
+    BoruvkaState state;
+    state.graph = graph;
+    state.edge_count = graph->edges;
+    state.src = (int*)safe_malloc(slots * sizeof(int));
+    state.dest = (int*)safe_malloc(slots * sizeof(int));
+    state.weight = (int*)safe_malloc(slots * sizeof(int));
+    state.live = (int*)safe_malloc(slots * sizeof(int));
+    state.in_tree = (bool*)safe_malloc(slots * sizeof(bool));
+    state.live_begin = (int*)safe_malloc(thread_count * sizeof(int));
+    state.live_end = (int*)safe_malloc(thread_count * sizeof(int));
+    state.component = (int*)safe_malloc(vertices * sizeof(int));
+    state.best = (unsigned long long*)safe_malloc(vertices * sizeof(unsigned long long));
+    state.merged = 0;
+
+    thread_pool_run(pool, count_edges_task, &state);
+
+    int offset = 0;
+    for (int t = 0; t < thread_count; t++) {
+        int count = state.live_begin[t];
+        state.live_begin[t] = offset;
+        state.live_end[t] = offset + count;
+        offset += count;
+    }
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SETUP);
+    thread_pool_run(pool, fill_edges_task, &state);
+    INSTR_PHASE_END(INSTR_PHASE_SETUP);
+
+    debug_print("Starting Boruvka's algorithm with %d threads on %d edges",
+               thread_count, state.edge_count);
+
+    int tree_edges = 0;
+    int round = 0;
+    while (tree_edges < vertices - 1) {
+        state.merged = 0;
+
+        INSTR_PHASE_BEGIN(INSTR_PHASE_SOLVE);
+        thread_pool_run(pool, find_min_edges_task, &state);
+        INSTR_PHASE_END(INSTR_PHASE_SOLVE);
+
+        INSTR_PHASE_BEGIN(INSTR_PHASE_MERGE);
+        thread_pool_run(pool, contract_task, &state);
+        INSTR_PHASE_END(INSTR_PHASE_MERGE);
+
+        round++;
+        debug_print("Boruvka round %d merged %d components", round, state.merged);
+
+        if (state.merged == 0) {
+            break;
+        }
+        tree_edges += state.merged;
+    }
+
+    destroy_thread_pool(pool);
+
+    int tree_slots = tree_edges > 0 ? tree_edges : 1;
+    *tree_src = (int*)safe_malloc(tree_slots * sizeof(int));
+    *tree_dest = (int*)safe_malloc(tree_slots * sizeof(int));
+    *tree_weight = (int*)safe_malloc(tree_slots * sizeof(int));
+
+    int next = 0;
+    for (int e = 0; e < state.edge_count; e++) {
+        if (state.in_tree[e]) {
+            (*tree_src)[next] = state.src[e];
+            (*tree_dest)[next] = state.dest[e];
+            (*tree_weight)[next] = state.weight[e];
+            next++;
+        }
+    }
+
+    safe_free((void**)&state.src);
+    safe_free((void**)&state.dest);
+    safe_free((void**)&state.weight);
+    safe_free((void**)&state.live);
+    safe_free((void**)&state.in_tree);
+    safe_free((void**)&state.live_begin);
+    safe_free((void**)&state.live_end);
+    safe_free((void**)&state.component);
+    safe_free((void**)&state.best);
+
+    debug_print("Boruvka's algorithm completed in %d rounds with %d tree edges",
+               round, tree_edges);
+    return tree_edges;
+}
+
+MST_Result* boruvka_mst(CSRGraph* graph, int start_vertex, int thread_count) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    if (start_vertex < 0 || start_vertex >= graph->vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    int* tree_src;
+    int* tree_dest;
+    int* tree_weight;
+    int tree_edges = collect_tree_edges(graph, thread_count, &tree_src, &tree_dest, &tree_weight);
+
+    if (tree_edges != graph->vertices - 1) {
+        error_exit("Graph is not connected");
+    }
+
+    MST_Result* result = mst_result_from_edges(graph->vertices, start_vertex, tree_edges,
+                                               tree_src, tree_dest, tree_weight);
+
+    safe_free((void**)&tree_src);
+    safe_free((void**)&tree_dest);
+    safe_free((void**)&tree_weight);
+
+    debug_print("Boruvka MST total weight: %lld", result->total_weight);
+    return result;
+}
+
+MST_Forest* boruvka_msf(CSRGraph* graph, int start_vertex, int thread_count) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    if (start_vertex < 0 || start_vertex >= graph->vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    int* tree_src;
+    int* tree_dest;
+    int* tree_weight;
+    int tree_edges = collect_tree_edges(graph, thread_count, &tree_src, &tree_dest, &tree_weight);
+
+    MST_Forest* forest = mst_forest_from_edges(graph->vertices, start_vertex, tree_edges,
+                                               tree_src, tree_dest, tree_weight);
+
+    safe_free((void**)&tree_src);
+    safe_free((void**)&tree_dest);
+    safe_free((void**)&tree_weight);
+
+    return forest;
+}
\ No newline at end of file
@@ -0,0 +1,503 @@
+#include "dynamic_mst.h"
+#include <string.h>
+
+typedef struct AdjacencyList {
+    int *neighbor;
+    int *weight;
+    int count;
+    int capacity;
+} AdjacencyList;
+
+typedef struct AdjacencyEntry {
+    int weight;
+    int neighbor;
+} AdjacencyEntry;
+
+struct DynamicMST {
+    MST_Result *result;
+    int vertices;
+    AdjacencyList *adjacency;
+    int *label;
+    int *label_stamp;
+    int *path;
+    int stamp;
+};
+
+static int tree_depth(const MST_Result* result, int vertex, int* root) {
+    int depth = 0;
+
+    while (result->parent[vertex] != -1) {
+        vertex = result->parent[vertex];
+        if (++depth >= result->vertex_count) {
+            error_exit("MST parent array contains a cycle");
+        }
+    }
+
+    *root = vertex;
+    return depth;
+}
+
+static void evert_path(MST_Result* result, int from, int stop, int new_parent, int weight) {
+    int child = from;
+    int link = new_parent;
+    int link_key = weight;
+
+    while (true) {
+        int next = result->parent[child];
+        int next_key = result->key[child];
+
+        result->parent[child] = link;
+        result->key[child] = link_key;
+
+        if (child == stop) {
+            break;
+        }
+
+        link = child;
+        link_key = next_key;
+        child = next;
+    }
+}
+
+bool mst_insert_edge(MST_Result* result, int u, int v, int weight) {
+    if (!result) {
+        error_exit("MST result is NULL");
+    }
+
+    if (u < 0 || u >= result->vertex_count || v < 0 || v >= result->vertex_count) {
+        error_exit("Invalid vertex indices");
+    }
+
+    if (weight < 0 || weight >= INF) {
+        error_exit("Invalid edge weight");
+    }
+
+    if (u == v) {
+        return false;
+    }
+
+    if (result->parent[u] == v || result->parent[v] == u) {
+        int child = result->parent[u] == v ? u : v;
+        if (weight >= result->key[child]) {
+            return false;
+        }
+
+        result->total_weight -= result->key[child] - weight;
+        result->key[child] = weight;
+        debug_print("Decreased tree edge (%d, %d) to %d", u, v, weight);
+        return true;
+    }
+
+    int root_u;
+    int root_v;
+    int depth_u = tree_depth(result, u, &root_u);
+    int depth_v = tree_depth(result, v, &root_v);
+
+    if (root_u != root_v) {
+        evert_path(result, u, root_u, v, weight);
+        result->total_weight += weight;
+        debug_print("Linked trees of %d and %d with weight %d", u, v, weight);
+        return true;
+    }
+
+    int a = u;
+    int b = v;
+    int max_key = -1;
+    int max_child = -1;
+    bool max_on_u_side = true;
+
+    while (depth_u > depth_v) {
+        if (result->key[a] > max_key) {
+            max_key = result->key[a];
+            max_child = a;
+            max_on_u_side = true;
+        }
+        a = result->parent[a];
+        depth_u--;
+    }
+
+    while (depth_v > depth_u) {
+        if (result->key[b] > max_key) {
+            max_key = result->key[b];
+            max_child = b;
+            max_on_u_side = false;
+        }
+        b = result->parent[b];
+        depth_v--;
+    }
+
+    while (a != b) {
+        if (result->key[a] > max_key) {
+            max_key = result->key[a];
+            max_child = a;
+            max_on_u_side = true;
+        }
+        if (result->key[b] > max_key) {
+            max_key = result->key[b];
+            max_child = b;
+            max_on_u_side = false;
+        }
+        a = result->parent[a];
+        b = result->parent[b];
+    }
+
+    if (weight >= max_key) {
+        return false;
+    }
+
+    if (max_on_u_side) {
+        evert_path(result, u, max_child, v, weight);
+    } else {
+        evert_path(result, v, max_child, u, weight);
+    }
+
+    result->total_weight -= max_key - weight;
+    debug_print("Replaced tree edge of weight %d with (%d, %d, %d)", max_key, u, v, weight);
+    return true;
+}
+
+static int adjacency_find(const AdjacencyList* list, int neighbor) {
+    for (int i = 0; i < list->count; i++) {
+        if (list->neighbor[i] == neighbor) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int compare_entries(const void* a, const void* b) {
+    const AdjacencyEntry* x = (const AdjacencyEntry*)a;
+    const AdjacencyEntry* y = (const AdjacencyEntry*)b;
+    if (x->weight != y->weight) {
+        return x->weight < y->weight ? -1 : 1;
+    }
+    return (x->neighbor > y->neighbor) - (x->neighbor < y->neighbor);
+}
+
+static void adjacency_remove(AdjacencyList* list, int index) {
+    int tail = list->count - index - 1;
+    memmove(list->neighbor + index, list->neighbor + index + 1, tail * sizeof(int));
+    memmove(list->weight + index, list->weight + index + 1, tail * sizeof(int));
+    list->count--;
+}
+
+static void adjacency_insert(AdjacencyList* list, int neighbor, int weight) {
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity > 0 ? list->capacity * 2 : 4;
+        list->neighbor = (int*)safe_realloc(list->neighbor, list->capacity * sizeof(int));
+        list->weight = (int*)safe_realloc(list->weight, list->capacity * sizeof(int));
+    }
+
+    int lo = 0;
+    int hi = list->count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (list->weight[mid] <= weight) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    int tail = list->count - lo;
+    memmove(list->neighbor + lo + 1, list->neighbor + lo, tail * sizeof(int));
+    memmove(list->weight + lo + 1, list->weight + lo, tail * sizeof(int));
+    list->neighbor[lo] = neighbor;
+    list->weight[lo] = weight;
+    list->count++;
+}
+
+static void set_index_weight(DynamicMST* dynamic, int u, int v, int weight) {
+    int slots[2][2] = { { u, v }, { v, u } };
+
+    for (int i = 0; i < 2; i++) {
+        AdjacencyList* list = &dynamic->adjacency[slots[i][0]];
+        int index = adjacency_find(list, slots[i][1]);
+        if (index >= 0) {
+            adjacency_remove(list, index);
+        }
+        if (weight != INF) {
+            adjacency_insert(list, slots[i][1], weight);
+        }
+    }
+}
+
+static void label_subtree(DynamicMST* dynamic, int cut) {
+    const int* parent = dynamic->result->parent;
+    int stamp = ++dynamic->stamp;
+
+    for (int w = 0; w < dynamic->vertices; w++) {
+        int length = 0;
+        int x = w;
+        int inside;
+
+        while (true) {
+            if (dynamic->label_stamp[x] == stamp) {
+                inside = dynamic->label[x];
+                break;
+            }
+            if (x == cut) {
+                inside = 1;
+                break;
+            }
+            if (parent[x] == -1) {
+                inside = 0;
+                break;
+            }
+            if (length >= dynamic->vertices) {
+                error_exit("MST parent array contains a cycle");
+            }
+            dynamic->path[length++] = x;
+            x = parent[x];
+        }
+
+        if (dynamic->label_stamp[x] != stamp) {
+            dynamic->label_stamp[x] = stamp;
+            dynamic->label[x] = inside;
+        }
+        for (int i = 0; i < length; i++) {
+            dynamic->label_stamp[dynamic->path[i]] = stamp;
+            dynamic->label[dynamic->path[i]] = inside;
+        }
+    }
+}
+
+static bool find_replacement(DynamicMST* dynamic, int* inner, int* outer, int* weight) {
+    int inside_count = 0;
+    for (int w = 0; w < dynamic->vertices; w++) {
+        inside_count += dynamic->label[w];
+    }
+
+    int side = inside_count * 2 <= dynamic->vertices ? 1 : 0;
+    int best_weight = INF;
+    int best_from = -1;
+    int best_to = -1;
+
+    for (int x = 0; x < dynamic->vertices; x++) {
+        if (dynamic->label[x] != side) {
+            continue;
+        }
+
+        const AdjacencyList* list = &dynamic->adjacency[x];
+        for (int i = 0; i < list->count && list->weight[i] < best_weight; i++) {
+            if (dynamic->label[list->neighbor[i]] != side) {
+                best_weight = list->weight[i];
+                best_from = x;
+                best_to = list->neighbor[i];
+                break;
+            }
+        }
+    }
+
+    if (best_from < 0) {
+        return false;
+    }
+
+    *inner = side ? best_from : best_to;
+    *outer = side ? best_to : best_from;
+    *weight = best_weight;
+    return true;
+}
+
+static void check_edge(DynamicMST* dynamic, int u, int v) {
+    if (!dynamic) {
+        error_exit("Dynamic MST is NULL");
+    }
+
+    if (u < 0 || u >= dynamic->vertices || v < 0 || v >= dynamic->vertices || u == v) {
+        error_exit("Invalid vertex indices");
+    }
+}
+
+static DynamicMST* alloc_dynamic_mst(MST_Result* result, int vertices) {
+    DynamicMST* dynamic = (DynamicMST*)safe_malloc(sizeof(DynamicMST));
+
+    dynamic->result = result;
+    dynamic->vertices = vertices;
+    dynamic->adjacency = (AdjacencyList*)safe_malloc(vertices * sizeof(AdjacencyList));
+    dynamic->label = (int*)safe_malloc(vertices * sizeof(int));
+    dynamic->label_stamp = (int*)safe_malloc(vertices * sizeof(int));
+    dynamic->path = (int*)safe_malloc(vertices * sizeof(int));
+    dynamic->stamp = 0;
+
+    for (int u = 0; u < vertices; u++) {
+        dynamic->label[u] = -1;
+        dynamic->label_stamp[u] = 0;
+    }
+
+    return dynamic;
+}
+
+static void build_adjacency(DynamicMST* dynamic, int u, AdjacencyEntry* entries, int count) {
+    AdjacencyList* list = &dynamic->adjacency[u];
+
+    qsort(entries, count, sizeof(AdjacencyEntry), compare_entries);
+
+    list->capacity = count > 0 ? count : 1;
+    list->neighbor = (int*)safe_malloc(list->capacity * sizeof(int));
+    list->weight = (int*)safe_malloc(list->capacity * sizeof(int));
+    list->count = 0;
+
+    for (int i = 0; i < count; i++) {
+        int v = entries[i].neighbor;
+        if (dynamic->label[v] == u) {
+            continue;
+        }
+        dynamic->label[v] = u;
+        list->neighbor[list->count] = v;
+        list->weight[list->count] = entries[i].weight;
+        list->count++;
+    }
+}
+
+DynamicMST* create_dynamic_mst(Graph* graph, MST_Result* result) {
+    if (!graph || !result) {
+        error_exit("Graph or MST result is NULL");
+    }
+
+    if (graph->vertices != result->vertex_count) {
+        error_exit("MST result does not match graph");
+    }
+
+    int vertices = graph->vertices;
+    DynamicMST* dynamic = alloc_dynamic_mst(result, vertices);
+    AdjacencyEntry* entries = (AdjacencyEntry*)safe_malloc(vertices * sizeof(AdjacencyEntry));
+
+    for (int u = 0; u < vertices; u++) {
+        const int* row = graph_row(graph, u);
+        int count = 0;
+
+        for (int v = 0; v < vertices; v++) {
+            if (v != u && row[v] != INF) {
+                entries[count].weight = row[v];
+                entries[count].neighbor = v;
+                count++;
+            }
+        }
+
+        build_adjacency(dynamic, u, entries, count);
+    }
+
+    safe_free((void**)&entries);
+
+    debug_print("Created dynamic MST index for %d vertices", vertices);
+    return dynamic;
+}
+
+DynamicMST* create_dynamic_mst_csr(CSRGraph* graph, MST_Result* result) {
+    if (!graph || !result) {
+        error_exit("Graph or MST result is NULL");
+    }
+
+    if (graph->vertices != result->vertex_count) {
+        error_exit("MST result does not match graph");
+    }
+
+    int vertices = graph->vertices;
+    int max_degree = 1;
+    for (int u = 0; u < vertices; u++) {
+        int degree = graph->offsets[u + 1] - graph->offsets[u];
+        if (degree > max_degree) {
+            max_degree = degree;
+        }
+    }
+
+    DynamicMST* dynamic = alloc_dynamic_mst(result, vertices);
+    AdjacencyEntry* entries = (AdjacencyEntry*)safe_malloc(max_degree * sizeof(AdjacencyEntry));
+
+    for (int u = 0; u < vertices; u++) {
+        int count = 0;
+
+        for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            if (graph->neighbors[e] != u) {
+                entries[count].weight = graph->weights[e];
+                entries[count].neighbor = graph->neighbors[e];
+                count++;
+            }
+        }
+
+        build_adjacency(dynamic, u, entries, count);
+    }
+
+    safe_free((void**)&entries);
+
+    debug_print("Created dynamic MST index for %d vertices and %d edges", vertices, graph->edges);
+    return dynamic;
+}
+
+int dynamic_mst_edge_weight(DynamicMST* dynamic, int u, int v) {
+    check_edge(dynamic, u, v);
+
+    const AdjacencyList* list = &dynamic->adjacency[u];
+    int index = adjacency_find(list, v);
+    return index >= 0 ? list->weight[index] : INF;
+}
+
+bool dynamic_mst_update_edge(DynamicMST* dynamic, int u, int v, int weight) {
+    check_edge(dynamic, u, v);
+
+    if (weight < 0 || weight > INF) {
+        error_exit("Invalid edge weight");
+    }
+
+    int old_weight = dynamic_mst_edge_weight(dynamic, u, v);
+    if (weight == old_weight) {
+        return false;
+    }
+
+    set_index_weight(dynamic, u, v, weight);
+
+    if (weight < old_weight) {
+        return mst_insert_edge(dynamic->result, u, v, weight);
+    }
+
+    MST_Result* result = dynamic->result;
+    int child;
+    if (result->parent[u] == v) {
+        child = u;
+    } else if (result->parent[v] == u) {
+        child = v;
+    } else {
+        return false;
+    }
+
+    label_subtree(dynamic, child);
+
+    int inner;
+    int outer;
+    int replacement;
+    result->total_weight -= result->key[child];
+
+    if (!find_replacement(dynamic, &inner, &outer, &replacement)) {
+        result->parent[child] = -1;
+        result->key[child] = 0;
+        debug_print("Edge (%d, %d) was a bridge; tree split at %d", u, v, child);
+        return true;
+    }
+
+    evert_path(result, inner, child, outer, replacement);
+    result->total_weight += replacement;
+    debug_print("Replaced tree edge (%d, %d) with (%d, %d, %d)", u, v, inner, outer, replacement);
+    return true;
+}
+
+bool dynamic_mst_delete_edge(DynamicMST* dynamic, int u, int v) {
+    return dynamic_mst_update_edge(dynamic, u, v, INF);
+}
+
+void destroy_dynamic_mst(DynamicMST* dynamic) {
+    if (!dynamic) {
+        return;
+    }
+
+    for (int u = 0; u < dynamic->vertices; u++) {
+        safe_free((void**)&dynamic->adjacency[u].neighbor);
+        safe_free((void**)&dynamic->adjacency[u].weight);
+    }
+
+    safe_free((void**)&dynamic->adjacency);
+    safe_free((void**)&dynamic->label);
+    safe_free((void**)&dynamic->label_stamp);
+    safe_free((void**)&dynamic->path);
+    safe_free((void**)&dynamic);
+}
\ No newline at end of file
@@ -0,0 +1,624 @@
+#include "euclidean_mst.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define EUCLIDEAN_X86 1
+#include <immintrin.h>
+#endif
+
+#define EUCLIDEAN_LANES 8
+
+typedef float (*DistanceRelaxFn)(const float* coords, int stride, int dimensions,
+                                 const float* origin, float* key, int* parent,
+                                 const int* live, int u, int n);
+
+typedef struct KDNode {
+    float low[KDTREE_MAX_DIMENSIONS];
+    float high[KDTREE_MAX_DIMENSIONS];
+    int begin;
+    int end;
+    int left;
+    int right;
+    int component;
+} KDNode;
+
+typedef struct KDTree {
+    const float *points;
+    int dimensions;
+    int *order;
+    KDNode *nodes;
+    int node_count;
+} KDTree;
+
+typedef struct CandidateEdge {
+    double distance;
+    int from;
+    int to;
+} CandidateEdge;
+
+static void check_points(const float* points, int count, int dimensions, int start_vertex) {
+    if (!points) {
+        error_exit("Point array is NULL");
+    }
+
+    if (count <= 0) {
+        error_exit("Number of points must be positive");
+    }
+
+    if (dimensions <= 0) {
+        error_exit("Number of dimensions must be positive");
+    }
+
+    if (start_vertex < 0 || start_vertex >= count) {
+        error_exit("Invalid start vertex");
+    }
+}
+
+static MST_Result_f64* create_result_f64(int vertices) {
+    MST_Result_f64* result = (MST_Result_f64*)safe_malloc(sizeof(MST_Result_f64));
+
+    result->parent = (int*)safe_malloc(vertices * sizeof(int));
+    result->key = (double*)safe_malloc(vertices * sizeof(double));
+    result->total_weight = 0.0;
+    result->vertex_count = vertices;
+
+    for (int i = 0; i < vertices; i++) {
+        result->parent[i] = -1;
+        result->key[i] = WEIGHT_NONE_f64;
+    }
+
+    return result;
+}
+
+MST_Result_f64* implicit_mst(int vertices, ImplicitWeightFn weight, void* context,
+                             int start_vertex) {
+    if (!weight) {
+        error_exit("Weight callback is NULL");
+    }
+
+    if (vertices <= 0) {
+        error_exit("Number of vertices must be positive");
+    }
+
+    if (start_vertex < 0 || start_vertex >= vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    MST_Result_f64* result = create_result_f64(vertices);
+    double* key = result->key;
+
+    bool* in_mst = (bool*)safe_malloc(vertices * sizeof(bool));
+    for (int i = 0; i < vertices; i++) {
+        in_mst[i] = false;
+    }
+
+    key[start_vertex] = 0.0;
+    int u = start_vertex;
+
+    for (int count = 1; count <= vertices; count++) {
+        in_mst[u] = true;
+        result->total_weight += key[u];
+
+        double min_key = WEIGHT_NONE_f64;
+        int next = -1;
+
+        for (int v = 0; v < vertices; v++) {
+            if (in_mst[v]) {
+                continue;
+            }
+
+            double w = weight(u, v, context);
+            if (w < key[v]) {
+                key[v] = w;
+                result->parent[v] = u;
+            }
+            if (key[v] < min_key) {
+                min_key = key[v];
+                next = v;
+            }
+        }
+
+        if (next == -1 && count < vertices) {
+            error_exit("Graph is not connected");
+        }
+        u = next;
+    }
+
+    safe_free((void**)&in_mst);
+
+    debug_print("Implicit MST over %d vertices, total weight %f", vertices, result->total_weight);
+    return result;
+}
+
+static float relax_distance_scalar(const float* coords, int stride, int dimensions,
+                                   const float* origin, float* key, int* parent,
+                                   const int* live, int u, int n) {
+    float min_key = WEIGHT_NONE_f32;
+
+    for (int v = 0; v < n; v++) {
+        if (!live[v]) {
+            continue;
+        }
+
+        float distance = 0.0f;
+        for (int k = 0; k < dimensions; k++) {
+            float diff = coords[(size_t)k * stride + v] - origin[k];
+            distance += diff * diff;
+        }
+
+        if (distance < key[v]) {
+            key[v] = distance;
+            parent[v] = u;
+        }
+        if (key[v] < min_key) {
+            min_key = key[v];
+        }
+    }
+
+    return min_key;
+}
+
+#ifdef EUCLIDEAN_X86
+
+__attribute__((target("avx2")))
+static float relax_distance_avx2(const float* coords, int stride, int dimensions,
+                                 const float* origin, float* key, int* parent,
+                                 const int* live, int u, int n) {
+    const __m256i owner = _mm256_set1_epi32(u);
+    __m256 best = _mm256_set1_ps(WEIGHT_NONE_f32);
+
+    for (int v = 0; v < n; v += EUCLIDEAN_LANES) {
+        __m256 distance = _mm256_setzero_ps();
+        for (int k = 0; k < dimensions; k++) {
+            __m256 diff = _mm256_sub_ps(_mm256_load_ps(coords + (size_t)k * stride + v),
+                                        _mm256_set1_ps(origin[k]));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(diff, diff));
+        }
+
+        __m256 current = _mm256_load_ps(key + v);
+        __m256 mask = _mm256_castsi256_ps(_mm256_load_si256((const __m256i*)(live + v)));
+        __m256 closer = _mm256_and_ps(_mm256_cmp_ps(distance, current, _CMP_LT_OQ), mask);
+
+        current = _mm256_blendv_ps(current, distance, closer);
+        _mm256_store_ps(key + v, current);
+
+        __m256i owners = _mm256_load_si256((const __m256i*)(parent + v));
+        owners = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(owners),
+                                                      _mm256_castsi256_ps(owner), closer));
+        _mm256_store_si256((__m256i*)(parent + v), owners);
+
+        best = _mm256_min_ps(best, _mm256_blendv_ps(_mm256_set1_ps(WEIGHT_NONE_f32),
+                                                    current, mask));
+    }
+
+    float lanes[EUCLIDEAN_LANES];
+    _mm256_storeu_ps(lanes, best);
+
+    float min_key = lanes[0];
+    for (int i = 1; i < EUCLIDEAN_LANES; i++) {
+        if (lanes[i] < min_key) {
+            min_key = lanes[i];
+        }
+    }
+    return min_key;
+}
+
+#endif
+
+static DistanceRelaxFn select_distance_kernel(DenseKernel kernel) {
+    if (kernel == DENSE_KERNEL_AUTO) {
+        kernel = dense_kernel_detect();
+    }
+
+    if (!dense_kernel_supported(kernel)) {
+        error_exit("Requested dense kernel is not supported on this CPU");
+    }
+
+#ifdef EUCLIDEAN_X86
+    if (kernel == DENSE_KERNEL_AVX2) {
+        return relax_distance_avx2;
+    }
+#endif
+    return relax_distance_scalar;
+}
+
+MST_Result_f64* euclidean_mst(const float* points, int count, int dimensions, int start_vertex) {
+    return euclidean_mst_kernel(points, count, dimensions, start_vertex, DENSE_KERNEL_AUTO);
+}
+
+MST_Result_f64* euclidean_mst_kernel(const float* points, int count, int dimensions,
+                                     int start_vertex, DenseKernel kernel) {
+    check_points(points, count, dimensions, start_vertex);
+
+    DistanceRelaxFn relax = select_distance_kernel(kernel);
+    int stride = (count + EUCLIDEAN_LANES - 1) / EUCLIDEAN_LANES * EUCLIDEAN_LANES;
+
+    float* coords = (float*)safe_aligned_malloc(CACHE_LINE_SIZE,
+                                                (size_t)dimensions * stride * sizeof(float));
+    float* key = (float*)safe_aligned_malloc(CACHE_LINE_SIZE, stride * sizeof(float));
+    int* parent = (int*)safe_aligned_malloc(CACHE_LINE_SIZE, stride * sizeof(int));
+    int* live = (int*)safe_aligned_malloc(CACHE_LINE_SIZE, stride * sizeof(int));
+    float* origin = (float*)safe_malloc(dimensions * sizeof(float));
+
+    for (int k = 0; k < dimensions; k++) {
+        float* column = coords + (size_t)k * stride;
+        for (int v = 0; v < stride; v++) {
+            column[v] = v < count ? points[(size_t)v * dimensions + k] : 0.0f;
+        }
+    }
+
+    for (int v = 0; v < stride; v++) {
+        key[v] = WEIGHT_NONE_f32;
+        parent[v] = -1;
+        live[v] = v < count ? -1 : 0;
+    }
+
+    MST_Result_f64* result = create_result_f64(count);
+    key[start_vertex] = 0.0f;
+    int u = start_vertex;
+
+    for (int added = 1; added <= count; added++) {
+        live[u] = 0;
+        result->parent[u] = parent[u];
+        result->key[u] = sqrt((double)key[u]);
+        result->total_weight += result->key[u];
+
+        if (added == count) {
+            break;
+        }
+
+        for (int k = 0; k < dimensions; k++) {
+            origin[k] = coords[(size_t)k * stride + u];
+        }
+
+        float min_key = relax(coords, stride, dimensions, origin, key, parent, live, u, stride);
+
+        u = -1;
+        for (int v = 0; v < count; v++) {
+            if (live[v] && key[v] == min_key) {
+                u = v;
+                break;
+            }
+        }
+
+        if (u < 0) {
+            error_exit("Point coordinates must be finite");
+        }
+    }
+
+    safe_free((void**)&coords);
+    safe_free((void**)&key);
+    safe_free((void**)&parent);
+    safe_free((void**)&live);
+    safe_free((void**)&origin);
+
+    debug_print("Euclidean MST (%s kernel) over %d points, total weight %f",
+               dense_kernel_name(kernel), count, result->total_weight);
+    return result;
+}
+
+static float point_coordinate(const KDTree* tree, int point, int dimension) {
+    return tree->points[(size_t)point * tree->dimensions + dimension];
+}
+
+static void select_median(KDTree* tree, int begin, int end, int nth, int dimension) {
+    int* order = tree->order;
+
+    while (end - begin > 1) {
+        float pivot = point_coordinate(tree, order[(begin + end) / 2], dimension);
+        int i = begin;
+        int j = end - 1;
+
+        while (i <= j) {
+            while (point_coordinate(tree, order[i], dimension) < pivot) {
+                i++;
+            }
+            while (point_coordinate(tree, order[j], dimension) > pivot) {
+                j--;
+            }
+            if (i <= j) {
+                int temp = order[i];
+                order[i] = order[j];
+                order[j] = temp;
+                i++;
+                j--;
+            }
+        }
+
+        if (nth <= j) {
+            end = j + 1;
+        } else if (nth >= i) {
+            begin = i;
+        } else {
+            return;
+        }
+    }
+}
+
+static int build_kd_node(KDTree* tree, int begin, int end) {
+    int index = tree->node_count++;
+    KDNode* node = &tree->nodes[index];
+    int dimensions = tree->dimensions;
+
+    node->begin = begin;
+    node->end = end;
+    node->left = -1;
+    node->right = -1;
+    node->component = -1;
+
+    for (int k = 0; k < dimensions; k++) {
+        node->low[k] = point_coordinate(tree, tree->order[begin], k);
+        node->high[k] = node->low[k];
+    }
+
+    for (int i = begin + 1; i < end; i++) {
+        for (int k = 0; k < dimensions; k++) {
+            float value = point_coordinate(tree, tree->order[i], k);
+            if (value < node->low[k]) {
+                node->low[k] = value;
+            }
+            if (value > node->high[k]) {
+                node->high[k] = value;
+            }
+        }
+    }
+
+    if (end - begin <= KDTREE_LEAF_SIZE) {
+        return index;
+    }
+
+    int split = 0;
+    for (int k = 1; k < dimensions; k++) {
+        if (node->high[k] - node->low[k] > node->high[split] - node->low[split]) {
+            split = k;
+        }
+    }
+
+    int middle = begin + (end - begin) / 2;
+    select_median(tree, begin, end, middle, split);
+
+    int left = build_kd_node(tree, begin, middle);
+    int right = build_kd_node(tree, middle, end);
+    tree->nodes[index].left = left;
+    tree->nodes[index].right = right;
+
+    return index;
+}
+
+static double box_distance(const KDNode* node, const float* point, int dimensions) {
+    double distance = 0.0;
+
+    for (int k = 0; k < dimensions; k++) {
+        double gap = 0.0;
+        if (point[k] < node->low[k]) {
+            gap = (double)node->low[k] - point[k];
+        } else if (point[k] > node->high[k]) {
+            gap = (double)point[k] - node->high[k];
+        }
+        distance += gap * gap;
+    }
+
+    return distance;
+}
+
+static int find_root(int* component, int x) {
+    while (component[x] != x) {
+        component[x] = component[component[x]];
+        x = component[x];
+    }
+    return x;
+}
+
+static bool edge_less(double distance, int from, int to, const CandidateEdge* best) {
+    if (best->from < 0 || distance < best->distance) {
+        return true;
+    }
+    if (distance > best->distance) {
+        return false;
+    }
+
+    int low = from < to ? from : to;
+    int high = from < to ? to : from;
+    int best_low = best->from < best->to ? best->from : best->to;
+    int best_high = best->from < best->to ? best->to : best->from;
+
+    return low < best_low || (low == best_low && high < best_high);
+}
+
+static void label_kd_components(KDTree* tree, const int* label) {
+    for (int index = tree->node_count - 1; index >= 0; index--) {
+        KDNode* node = &tree->nodes[index];
+
+        if (node->left < 0) {
+            node->component = label[tree->order[node->begin]];
+            for (int i = node->begin + 1; i < node->end; i++) {
+                if (label[tree->order[i]] != node->component) {
+                    node->component = -1;
+                    break;
+                }
+            }
+        } else {
+            int left = tree->nodes[node->left].component;
+            node->component = left == tree->nodes[node->right].component ? left : -1;
+        }
+    }
+}
+
+static void nearest_foreign_point(const KDTree* tree, const int* label, int point,
+                                  CandidateEdge* best) {
+    const float* origin = tree->points + (size_t)point * tree->dimensions;
+    int own = label[point];
+    int stack[128];
+    int top = 0;
+
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const KDNode* node = &tree->nodes[stack[--top]];
+
+        if (node->component == own) {
+            continue;
+        }
+
+        if (best->from >= 0 && box_distance(node, origin, tree->dimensions) > best->distance) {
+            continue;
+        }
+
+        if (node->left < 0) {
+            for (int i = node->begin; i < node->end; i++) {
+                int other = tree->order[i];
+                if (label[other] == own) {
+                    continue;
+                }
+
+                double distance = 0.0;
+                for (int k = 0; k < tree->dimensions; k++) {
+                    double diff = (double)origin[k] - point_coordinate(tree, other, k);
+                    distance += diff * diff;
+                }
+
+                if (edge_less(distance, point, other, best)) {
+                    best->distance = distance;
+                    best->from = point;
+                    best->to = other;
+                }
+            }
+            continue;
+        }
+
+        double left = box_distance(&tree->nodes[node->left], origin, tree->dimensions);
+        double right = box_distance(&tree->nodes[node->right], origin, tree->dimensions);
+
+        if (left <= right) {
+            stack[top++] = node->right;
+            stack[top++] = node->left;
+        } else {
+            stack[top++] = node->left;
+            stack[top++] = node->right;
+        }
+    }
+}
+
+static MST_Result_f64* result_from_tree_edges(int count, int start_vertex, int edge_count,
+                                              const int* src, const int* dest,
+                                              const double* weight) {
+    CSRGraph_f64* tree = create_csr_graph_f64(count, edge_count, src, dest, weight);
+    if (!tree) {
+        error_exit("Invalid Euclidean MST tree edge");
+    }
+    MST_Result_f64* result = create_result_f64(count);
+    int* queue = (int*)safe_malloc(count * sizeof(int));
+    int head = 0;
+    int tail = 0;
+
+    queue[tail++] = start_vertex;
+    result->key[start_vertex] = 0.0;
+
+    while (head < tail) {
+        int u = queue[head++];
+
+        for (int e = tree->offsets[u]; e < tree->offsets[u + 1]; e++) {
+            int v = tree->neighbors[e];
+            if (v != start_vertex && result->parent[v] == -1) {
+                result->parent[v] = u;
+                result->key[v] = tree->weights[e];
+                result->total_weight += tree->weights[e];
+                queue[tail++] = v;
+            }
+        }
+    }
+
+    safe_free((void**)&queue);
+    destroy_csr_graph_f64(tree);
+    return result;
+}
+
+MST_Result_f64* euclidean_mst_kdtree(const float* points, int count, int dimensions,
+                                     int start_vertex) {
+    check_points(points, count, dimensions, start_vertex);
+
+    if (dimensions > KDTREE_MAX_DIMENSIONS) {
+        error_exit("k-d tree supports at most 8 dimensions");
+    }
+
+    KDTree tree;
+    tree.points = points;
+    tree.dimensions = dimensions;
+    tree.order = (int*)safe_malloc(count * sizeof(int));
+    tree.nodes = (KDNode*)safe_malloc((2 * (count / (KDTREE_LEAF_SIZE / 2)) + 2) * sizeof(KDNode));
+    tree.node_count = 0;
+
+    for (int i = 0; i < count; i++) {
+        tree.order[i] = i;
+    }
+    build_kd_node(&tree, 0, count);
+
+    int* component = (int*)safe_malloc(count * sizeof(int));
+    int* label = (int*)safe_malloc(count * sizeof(int));
+    CandidateEdge* best = (CandidateEdge*)safe_malloc(count * sizeof(CandidateEdge));
+    int edge_slots = count > 1 ? count - 1 : 1;
+    int* tree_src = (int*)safe_malloc(edge_slots * sizeof(int));
+    int* tree_dest = (int*)safe_malloc(edge_slots * sizeof(int));
+    double* tree_weight = (double*)safe_malloc(edge_slots * sizeof(double));
+
+    for (int i = 0; i < count; i++) {
+        component[i] = i;
+    }
+
+    int edges = 0;
+    int round = 0;
+    while (edges < count - 1) {
+        for (int i = 0; i < count; i++) {
+            label[i] = find_root(component, i);
+            best[i].from = -1;
+        }
+        label_kd_components(&tree, label);
+
+        for (int i = 0; i < count; i++) {
+            int point = tree.order[i];
+            nearest_foreign_point(&tree, label, point, &best[label[point]]);
+        }
+
+        int merged = 0;
+        for (int i = 0; i < count; i++) {
+            if (label[i] != i || best[i].from < 0) {
+                continue;
+            }
+
+            int a = find_root(component, best[i].from);
+            int b = find_root(component, best[i].to);
+            if (a == b) {
+                continue;
+            }
+
+            component[a > b ? a : b] = a < b ? a : b;
+            tree_src[edges] = best[i].from;
+            tree_dest[edges] = best[i].to;
+            tree_weight[edges] = sqrt(best[i].distance);
+            edges++;
+            merged++;
+        }
+
+        round++;
+        debug_print("k-d Boruvka round %d merged %d components", round, merged);
+
+        if (merged == 0) {
+            error_exit("Point coordinates must be finite");
+        }
+    }
+
+    MST_Result_f64* result = result_from_tree_edges(count, start_vertex, edges,
+                                                    tree_src, tree_dest, tree_weight);
+
+    safe_free((void**)&tree.order);
+    safe_free((void**)&tree.nodes);
+    safe_free((void**)&component);
+    safe_free((void**)&label);
+    safe_free((void**)&best);
+    safe_free((void**)&tree_src);
+    safe_free((void**)&tree_dest);
+    safe_free((void**)&tree_weight);
+
+    debug_print("k-d Boruvka Euclidean MST over %d points in %d rounds, total weight %f",
+               count, round, result->total_weight);
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,688 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "external_mst.h"
+#include "instrument.h"
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+struct EdgeFileWriter {
+    FILE *file;
+    char *path;
+    ExternalEdge *buffer;
+    size_t capacity;
+    size_t count;
+    int64_t edges;
+    int vertices;
+    int max_weight;
+    bool failed;
+};
+
+typedef struct EdgeRun {
+    FILE *file;
+    int64_t records;
+} EdgeRun;
+
+typedef struct EdgeStream {
+    FILE *file;
+    ExternalEdge *buffer;
+    size_t capacity;
+    size_t count;
+    size_t position;
+    int64_t remaining;
+    bool failed;
+} EdgeStream;
+
+typedef struct KruskalState {
+    int *parent;
+    unsigned char *rank;
+    int *src;
+    int *dest;
+    int *weight;
+    int tree_edges;
+    int vertices;
+} KruskalState;
+
+static void external_error(const char* path, const char* message) {
+    fprintf(stderr, "Error: %s: %s\n", path, message);
+}
+
+ExternalMSTConfig default_external_config(void) {
+    ExternalMSTConfig config;
+    const char* temp_dir = getenv("TMPDIR");
+
+    config.memory_budget = EXTERNAL_DEFAULT_MEMORY_BUDGET;
+    config.io_buffer_size = EXTERNAL_DEFAULT_IO_BUFFER;
+    config.temp_dir = (temp_dir && temp_dir[0]) ? temp_dir : "/tmp";
+
+    return config;
+}
+
+static size_t buffer_records(size_t bytes) {
+    size_t records = bytes / sizeof(ExternalEdge);
+    return records > 0 ? records : 1;
+}
+
+static bool write_edge_header(FILE* file, int vertices, int64_t edges, int max_weight) {
+    GraphFileHeader header;
+
+    memset(&header, 0, sizeof(GraphFileHeader));
+    memcpy(header.magic, GRAPH_FILE_MAGIC, sizeof(GRAPH_FILE_MAGIC));
+    header.version = GRAPH_FILE_VERSION;
+    header.layout = GRAPH_FILE_EDGES;
+    header.endian_tag = GRAPH_FILE_ENDIAN_TAG;
+    header.vertices = vertices;
+    header.edges = edges <= INT32_MAX ? (int32_t)edges : -1;
+    header.max_weight = max_weight;
+    header.file_size = sizeof(GraphFileHeader) + (uint64_t)edges * sizeof(ExternalEdge);
+
+    return fseek(file, 0, SEEK_SET) == 0 &&
+           fwrite(&header, sizeof(header), 1, file) == 1;
+}
+
+EdgeFileWriter* create_edge_file(const char* path, int vertices, size_t buffer_size) {
+    if (!path || vertices <= 0) {
+        return NULL;
+    }
+
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        external_error(path, "cannot open file for writing");
+        return NULL;
+    }
+
+    if (!write_edge_header(file, vertices, 0, 0)) {
+        external_error(path, "write failed");
+        fclose(file);
+        return NULL;
+    }
+
+    EdgeFileWriter* writer = (EdgeFileWriter*)safe_malloc(sizeof(EdgeFileWriter));
+    writer->file = file;
+    writer->path = (char*)safe_malloc(strlen(path) + 1);
+    strcpy(writer->path, path);
+    writer->capacity = buffer_records(buffer_size > 0 ? buffer_size : EXTERNAL_DEFAULT_IO_BUFFER);
+    writer->buffer = (ExternalEdge*)safe_malloc(writer->capacity * sizeof(ExternalEdge));
+    writer->count = 0;
+    writer->edges = 0;
+    writer->vertices = vertices;
+    writer->max_weight = 0;
+    writer->failed = false;
+
+    return writer;
+}
+
+static void flush_edge_file(EdgeFileWriter* writer) {
+    if (writer->count > 0 && !writer->failed &&
+        fwrite(writer->buffer, sizeof(ExternalEdge), writer->count, writer->file) != writer->count) {
+        writer->failed = true;
+    }
+    writer->count = 0;
+}
+
+bool edge_file_append(EdgeFileWriter* writer, int src, int dest, int weight) {
+    if (!writer || src < 0 || dest < 0 || src >= writer->vertices || dest >= writer->vertices ||
+        weight < 0 || weight >= INF) {
+        return false;
+    }
+
+    if (writer->count == writer->capacity) {
+        flush_edge_file(writer);
+    }
+
+    writer->buffer[writer->count].src = src;
+    writer->buffer[writer->count].dest = dest;
+    writer->buffer[writer->count].weight = weight;
+    writer->count++;
+    writer->edges++;
+
+    if (weight > writer->max_weight) {
+        writer->max_weight = weight;
+    }
+
+    return !writer->failed;
+}
+
+bool close_edge_file(EdgeFileWriter* writer) {
+    if (!writer) {
+        return false;
+    }
+
+    flush_edge_file(writer);
+
+    bool ok = !writer->failed &&
+              write_edge_header(writer->file, writer->vertices, writer->edges, writer->max_weight);
+
+    if (fclose(writer->file) != 0 || !ok) {
+        external_error(writer->path, "write failed");
+        ok = false;
+    } else {
+        debug_print("Saved edge file with %d vertices and %lld edges to %s",
+                   writer->vertices, (long long)writer->edges, writer->path);
+    }
+
+    safe_free((void**)&writer->buffer);
+    safe_free((void**)&writer->path);
+    safe_free((void**)&writer);
+    return ok;
+}
+
+static void open_stream(EdgeStream* stream, FILE* file, int64_t records, size_t buffer_size) {
+    stream->file = file;
+    stream->capacity = buffer_records(buffer_size);
+    stream->buffer = (ExternalEdge*)safe_malloc(stream->capacity * sizeof(ExternalEdge));
+    stream->count = 0;
+    stream->position = 0;
+    stream->remaining = records;
+    stream->failed = false;
+}
+
+static const ExternalEdge* stream_peek(EdgeStream* stream) {
+    if (stream->position < stream->count) {
+        return &stream->buffer[stream->position];
+    }
+
+    if (stream->remaining == 0 || stream->failed) {
+        return NULL;
+    }
+
+    size_t wanted = stream->remaining < (int64_t)stream->capacity ?
+                    (size_t)stream->remaining : stream->capacity;
+
+    if (fread(stream->buffer, sizeof(ExternalEdge), wanted, stream->file) != wanted) {
+        stream->failed = true;
+        return NULL;
+    }
+
+    stream->count = wanted;
+    stream->position = 0;
+    stream->remaining -= (int64_t)wanted;
+    return &stream->buffer[0];
+}
+
+static void close_stream(EdgeStream* stream) {
+    if (stream->file) {
+        fclose(stream->file);
+        stream->file = NULL;
+    }
+    safe_free((void**)&stream->buffer);
+}
+
+static bool edge_before(const ExternalEdge* a, const ExternalEdge* b) {
+    if (a->weight != b->weight) {
+        return a->weight < b->weight;
+    }
+    if (a->src != b->src) {
+        return a->src < b->src;
+    }
+    return a->dest < b->dest;
+}
+
+static int compare_edges(const void* a, const void* b) {
+    const ExternalEdge* left = (const ExternalEdge*)a;
+    const ExternalEdge* right = (const ExternalEdge*)b;
+
+    if (edge_before(left, right)) {
+        return -1;
+    }
+    return edge_before(right, left) ? 1 : 0;
+}
+
+static FILE* create_spill_file(const char* temp_dir) {
+    size_t length = strlen(temp_dir) + 32;
+    char* path = (char*)safe_malloc(length);
+    snprintf(path, length, "%s/prim_mst_XXXXXX", temp_dir);
+
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        external_error(path, "cannot create temporary file");
+        safe_free((void**)&path);
+        return NULL;
+    }
+
+    unlink(path);
+    safe_free((void**)&path);
+
+    FILE* file = fdopen(fd, "w+b");
+    if (!file) {
+        close(fd);
+        return NULL;
+    }
+
+    setvbuf(file, NULL, _IONBF, 0);
+    return file;
+}
+
+static bool spill_edges(FILE* file, const ExternalEdge* edges, size_t count,
+                        ExternalMSTStats* stats) {
+    if (fwrite(edges, sizeof(ExternalEdge), count, file) != count) {
+        return false;
+    }
+    stats->bytes_spilled += (uint64_t)count * sizeof(ExternalEdge);
+    return true;
+}
+
+static void push_run(EdgeRun** runs, int* count, int* capacity, FILE* file, int64_t records) {
+    if (*count == *capacity) {
+        *capacity = *capacity > 0 ? *capacity * 2 : 16;
+        *runs = (EdgeRun*)safe_realloc(*runs, *capacity * sizeof(EdgeRun));
+    }
+
+    (*runs)[*count].file = file;
+    (*runs)[*count].records = records;
+    (*count)++;
+}
+
+static void close_runs(EdgeRun* runs, int count) {
+    for (int i = 0; i < count; i++) {
+        if (runs[i].file) {
+            fclose(runs[i].file);
+            runs[i].file = NULL;
+        }
+    }
+}
+
+static int find_set(int* parent, int x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+static bool kruskal_accept(KruskalState* state, const ExternalEdge* edge) {
+    int a = find_set(state->parent, edge->src);
+    int b = find_set(state->parent, edge->dest);
+
+    if (a == b) {
+        return false;
+    }
+
+    if (state->rank[a] < state->rank[b]) {
+        int temp = a;
+        a = b;
+        b = temp;
+    }
+    state->parent[b] = a;
+    if (state->rank[a] == state->rank[b]) {
+        state->rank[a]++;
+    }
+
+    state->src[state->tree_edges] = edge->src;
+    state->dest[state->tree_edges] = edge->dest;
+    state->weight[state->tree_edges] = edge->weight;
+    state->tree_edges++;
+    return true;
+}
+
+static void sift_down(int* heap, int size, EdgeStream* streams, int i) {
+    while (true) {
+        int smallest = i;
+        int left = 2 * i + 1;
+        int right = 2 * i + 2;
+
+        if (left < size && edge_before(stream_peek(&streams[heap[left]]),
+                                       stream_peek(&streams[heap[smallest]]))) {
+            smallest = left;
+        }
+        if (right < size && edge_before(stream_peek(&streams[heap[right]]),
+                                        stream_peek(&streams[heap[smallest]]))) {
+            smallest = right;
+        }
+        if (smallest == i) {
+            return;
+        }
+
+        int temp = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = temp;
+        i = smallest;
+    }
+}
+
+static bool merge_runs(EdgeRun* runs, int count, size_t buffer_size, FILE* output,
+                       KruskalState* kruskal, ExternalMSTStats* stats) {
+    EdgeStream* streams = (EdgeStream*)safe_malloc(count * sizeof(EdgeStream));
+    int* heap = (int*)safe_malloc(count * sizeof(int));
+    int size = 0;
+    bool ok = true;
+
+    for (int i = 0; i < count; i++) {
+        ok = ok && fseek(runs[i].file, 0, SEEK_SET) == 0;
+        open_stream(&streams[i], runs[i].file, runs[i].records, buffer_size);
+        runs[i].file = NULL;
+    }
+
+    for (int i = 0; i < count && ok; i++) {
+        if (stream_peek(&streams[i])) {
+            heap[size++] = i;
+        }
+    }
+    for (int i = size / 2 - 1; i >= 0; i--) {
+        sift_down(heap, size, streams, i);
+    }
+
+    size_t out_capacity = buffer_records(buffer_size);
+    ExternalEdge* out = output ? (ExternalEdge*)safe_malloc(out_capacity * sizeof(ExternalEdge)) : NULL;
+    size_t out_count = 0;
+
+    while (ok && size > 0) {
+        EdgeStream* top = &streams[heap[0]];
+        const ExternalEdge* edge = stream_peek(top);
+
+        if (output) {
+            out[out_count++] = *edge;
+            if (out_count == out_capacity) {
+                ok = spill_edges(output, out, out_count, stats);
+                out_count = 0;
+            }
+        } else {
+            stats->edges_scanned++;
+            INSTR_COUNT(INSTR_RELAX_SCANNED);
+            if (kruskal_accept(kruskal, edge)) {
+                INSTR_COUNT(INSTR_RELAX_TAKEN);
+            }
+            if (kruskal->tree_edges == kruskal->vertices - 1) {
+                break;
+            }
+        }
+
+        top->position++;
+        if (!stream_peek(top)) {
+            ok = !top->failed;
+            heap[0] = heap[--size];
+        }
+        sift_down(heap, size, streams, 0);
+    }
+
+    if (output && ok && out_count > 0) {
+        ok = spill_edges(output, out, out_count, stats);
+    }
+
+    for (int i = 0; i < count; i++) {
+        close_stream(&streams[i]);
+    }
+
+    safe_free((void**)&out);
+    safe_free((void**)&streams);
+    safe_free((void**)&heap);
+    return ok;
+}
+
+static FILE* open_edge_file(const char* path, int* vertices, int64_t* edges) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        external_error(path, "cannot open file");
+        return NULL;
+    }
+
+    GraphFileHeader header;
+    long size = -1;
+
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, GRAPH_FILE_MAGIC, sizeof(GRAPH_FILE_MAGIC)) != 0 ||
+        header.layout != GRAPH_FILE_EDGES) {
+        external_error(path, "not a binary edge file");
+        fclose(file);
+        return NULL;
+    }
+
+    if (header.endian_tag != GRAPH_FILE_ENDIAN_TAG || header.version != GRAPH_FILE_VERSION ||
+        header.vertices <= 0) {
+        external_error(path, "unsupported edge file header");
+        fclose(file);
+        return NULL;
+    }
+
+    if (fseek(file, 0, SEEK_END) == 0) {
+        size = ftell(file);
+    }
+
+    if (size < 0 || header.file_size != (uint64_t)size ||
+        ((uint64_t)size - sizeof(GraphFileHeader)) % sizeof(ExternalEdge) != 0 ||
+        fseek(file, sizeof(GraphFileHeader), SEEK_SET) != 0) {
+        external_error(path, "edge file is truncated");
+        fclose(file);
+        return NULL;
+    }
+
+    setvbuf(file, NULL, _IONBF, 0);
+    *vertices = header.vertices;
+    *edges = (int64_t)(((uint64_t)size - sizeof(GraphFileHeader)) / sizeof(ExternalEdge));
+    return file;
+}
+
+static bool form_runs(const char* path, EdgeStream* input, int vertices,
+                      const ExternalMSTConfig* config, size_t run_capacity,
+                      EdgeRun** runs, int* run_count, ExternalMSTStats* stats) {
+    ExternalEdge* buffer = (ExternalEdge*)safe_malloc(run_capacity * sizeof(ExternalEdge));
+    int capacity = 0;
+    bool ok = true;
+
+    while (ok && stream_peek(input)) {
+        size_t filled = 0;
+        const ExternalEdge* edge;
+
+        while (filled < run_capacity && (edge = stream_peek(input))) {
+            ExternalEdge e = *edge;
+            input->position++;
+            stats->edges_read++;
+
+            if (e.src < 0 || e.dest < 0 || e.src >= vertices || e.dest >= vertices) {
+                external_error(path, "edge endpoint exceeds vertex count");
+                ok = false;
+                break;
+            }
+            if (e.weight < 0 || e.weight >= INF) {
+                external_error(path, "edge weight out of range");
+                ok = false;
+                break;
+            }
+            if (e.src == e.dest) {
+                continue;
+            }
+            if (e.src > e.dest) {
+                int32_t temp = e.src;
+                e.src = e.dest;
+                e.dest = temp;
+            }
+            buffer[filled++] = e;
+        }
+
+        if (!ok || filled == 0) {
+            break;
+        }
+
+        qsort(buffer, filled, sizeof(ExternalEdge), compare_edges);
+
+        FILE* spill = create_spill_file(config->temp_dir);
+        if (!spill || !spill_edges(spill, buffer, filled, stats)) {
+            if (spill) {
+                fclose(spill);
+            }
+            external_error(config->temp_dir, "cannot write sorted run");
+            ok = false;
+            break;
+        }
+
+        push_run(runs, run_count, &capacity, spill, (int64_t)filled);
+    }
+
+    if (ok && input->failed) {
+        external_error(path, "read failed");
+        ok = false;
+    }
+
+    safe_free((void**)&buffer);
+    return ok;
+}
+
+static bool merge_pass(EdgeRun** runs, int* run_count, int fan_in, const ExternalMSTConfig* config,
+                       ExternalMSTStats* stats) {
+    EdgeRun* merged = NULL;
+    int merged_count = 0;
+    int capacity = 0;
+    bool ok = true;
+
+    for (int first = 0; first < *run_count && ok; first += fan_in) {
+        int group = *run_count - first < fan_in ? *run_count - first : fan_in;
+        int64_t records = 0;
+
+        for (int i = 0; i < group; i++) {
+            records += (*runs)[first + i].records;
+        }
+
+        FILE* output = create_spill_file(config->temp_dir);
+        if (!output) {
+            ok = false;
+            break;
+        }
+
+        ok = merge_runs(*runs + first, group, config->io_buffer_size, output, NULL, stats);
+        push_run(&merged, &merged_count, &capacity, output, records);
+    }
+
+    close_runs(*runs, *run_count);
+    safe_free((void**)runs);
+
+    *runs = merged;
+    *run_count = merged_count;
+    stats->merge_passes++;
+    return ok;
+}
+
+static void free_tree_edges(KruskalState* kruskal) {
+    safe_free((void**)&kruskal->src);
+    safe_free((void**)&kruskal->dest);
+    safe_free((void**)&kruskal->weight);
+}
+
+static bool external_kruskal(const char* path, int start_vertex, const ExternalMSTConfig* config,
+                             ExternalMSTStats* stats, KruskalState* kruskal) {
+    if (!path) {
+        return false;
+    }
+
+    ExternalMSTConfig settings = config ? *config : default_external_config();
+    ExternalMSTStats local;
+    memset(&local, 0, sizeof(local));
+
+    if (settings.io_buffer_size < EXTERNAL_MIN_IO_BUFFER) {
+        settings.io_buffer_size = EXTERNAL_MIN_IO_BUFFER;
+    }
+    if (!settings.temp_dir) {
+        settings.temp_dir = default_external_config().temp_dir;
+    }
+
+    int vertices;
+    int64_t edges;
+    FILE* file = open_edge_file(path, &vertices, &edges);
+    if (!file) {
+        return false;
+    }
+
+    if (start_vertex < 0 || start_vertex >= vertices) {
+        fclose(file);
+        error_exit("Invalid start vertex");
+    }
+
+    size_t io_size = settings.io_buffer_size;
+    size_t kruskal_bytes = (size_t)vertices * (4 * sizeof(int) + sizeof(unsigned char));
+
+    if (settings.memory_budget < kruskal_bytes + 2 * io_size ||
+        settings.memory_budget < 3 * io_size) {
+        external_error(path, "memory budget too small for the vertex set");
+        fclose(file);
+        return false;
+    }
+
+    EdgeStream input;
+    EdgeRun* runs = NULL;
+    int run_count = 0;
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_IO);
+    open_stream(&input, file, edges, io_size);
+    bool ok = form_runs(path, &input, vertices, &settings,
+                        buffer_records(settings.memory_budget - io_size), &runs, &run_count, &local);
+    close_stream(&input);
+
+    int fan_in = (int)(settings.memory_budget / io_size) - 1;
+    int final_fan_in = (int)((settings.memory_budget - kruskal_bytes) / io_size);
+
+    while (ok && run_count > final_fan_in) {
+        ok = merge_pass(&runs, &run_count, fan_in, &settings, &local);
+    }
+    INSTR_PHASE_END(INSTR_PHASE_IO);
+
+    kruskal->vertices = vertices;
+    kruskal->tree_edges = 0;
+    kruskal->parent = (int*)safe_malloc(vertices * sizeof(int));
+    kruskal->rank = (unsigned char*)safe_malloc(vertices * sizeof(unsigned char));
+    kruskal->src = (int*)safe_malloc(vertices * sizeof(int));
+    kruskal->dest = (int*)safe_malloc(vertices * sizeof(int));
+    kruskal->weight = (int*)safe_malloc(vertices * sizeof(int));
+
+    for (int i = 0; i < vertices; i++) {
+        kruskal->parent[i] = i;
+        kruskal->rank[i] = 0;
+    }
+
+    local.run_count = run_count;
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SOLVE);
+    if (ok && run_count > 0 && vertices > 1) {
+        ok = merge_runs(runs, run_count, io_size, NULL, kruskal, &local);
+    }
+    INSTR_PHASE_END(INSTR_PHASE_SOLVE);
+
+    close_runs(runs, run_count);
+    safe_free((void**)&runs);
+    safe_free((void**)&kruskal->parent);
+    safe_free((void**)&kruskal->rank);
+
+    if (!ok) {
+        external_error(path, "external MST failed");
+        free_tree_edges(kruskal);
+    }
+
+    debug_print("External Kruskal over %lld edges: %d runs, %d merge passes, %d tree edges",
+               (long long)local.edges_read, local.run_count, local.merge_passes,
+               kruskal->tree_edges);
+
+    if (stats) {
+        *stats = local;
+    }
+    return ok;
+}
+
+MST_Result* external_mst(const char* path, int start_vertex, const ExternalMSTConfig* config,
+                         ExternalMSTStats* stats) {
+    KruskalState kruskal;
+    if (!external_kruskal(path, start_vertex, config, stats, &kruskal)) {
+        return NULL;
+    }
+
+    MST_Result* result = NULL;
+    if (kruskal.tree_edges == kruskal.vertices - 1) {
+        result = mst_result_from_edges(kruskal.vertices, start_vertex, kruskal.tree_edges,
+                                       kruskal.src, kruskal.dest, kruskal.weight);
+    } else {
+        external_error(path, "graph is not connected (use external_msf for a spanning forest)");
+    }
+
+    free_tree_edges(&kruskal);
+    return result;
+}
+
+MST_Forest* external_msf(const char* path, int start_vertex, const ExternalMSTConfig* config,
+                         ExternalMSTStats* stats) {
+    KruskalState kruskal;
+    if (!external_kruskal(path, start_vertex, config, stats, &kruskal)) {
+        return NULL;
+    }
+
+    MST_Forest* forest = mst_forest_from_edges(kruskal.vertices, start_vertex, kruskal.tree_edges,
+                                               kruskal.src, kruskal.dest, kruskal.weight);
+
+    free_tree_edges(&kruskal);
+    return forest;
+}
\ No newline at end of file
@@ -0,0 +1,253 @@
+#include "generator.h"
+#include <math.h>
+
+typedef struct EdgeList {
+    int *src;
+    int *dest;
+    int *weight;
+    int count;
+    int capacity;
+} EdgeList;
+
+static unsigned long long next_random(unsigned long long* state) {
+    unsigned long long z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static int random_below(unsigned long long* state, int bound) {
+    return (int)(next_random(state) % (unsigned long long)bound);
+}
+
+static double random_unit(unsigned long long* state) {
+    return (next_random(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static void init_edge_list(EdgeList* list, long long capacity) {
+    if (capacity < 1) {
+        capacity = 1;
+    }
+    if (capacity > INT_MAX / 2) {
+        error_exit("Too many edges requested");
+    }
+
+    list->capacity = (int)capacity;
+    list->count = 0;
+    list->src = (int*)safe_malloc(list->capacity * sizeof(int));
+    list->dest = (int*)safe_malloc(list->capacity * sizeof(int));
+    list->weight = (int*)safe_malloc(list->capacity * sizeof(int));
+}
+
+static void push_edge(EdgeList* list, int src, int dest, int weight) {
+    if (list->count == list->capacity) {
+        if (list->capacity > INT_MAX / 4) {
+            error_exit("Too many edges requested");
+        }
+        list->capacity *= 2;
+        list->src = (int*)safe_realloc(list->src, list->capacity * sizeof(int));
+        list->dest = (int*)safe_realloc(list->dest, list->capacity * sizeof(int));
+        list->weight = (int*)safe_realloc(list->weight, list->capacity * sizeof(int));
+    }
+
+    list->src[list->count] = src;
+    list->dest[list->count] = dest;
+    list->weight[list->count] = weight;
+    list->count++;
+}
+
+static CSRGraph* build_from_list(int vertices, EdgeList* list) {
+    CSRGraph* graph = create_csr_graph(vertices, list->count, list->src, list->dest, list->weight);
+
+    safe_free((void**)&list->src);
+    safe_free((void**)&list->dest);
+    safe_free((void**)&list->weight);
+
+    return graph;
+}
+
+static void check_parameters(int vertices, int max_weight) {
+    if (vertices <= 0) {
+        error_exit("Number of vertices must be positive");
+    }
+
+    if (max_weight < 0 || max_weight >= INF) {
+        error_exit("Invalid maximum weight");
+    }
+}
+
+CSRGraph* generate_erdos_renyi(int vertices, double avg_degree, int max_weight,
+                               unsigned long long seed) {
+    check_parameters(vertices, max_weight);
+
+    long long target = (long long)(vertices * avg_degree / 2.0);
+    if (target < vertices - 1) {
+        target = vertices - 1;
+    }
+
+    EdgeList list;
+    init_edge_list(&list, target);
+    unsigned long long state = seed;
+
+    for (int v = 1; v < vertices; v++) {
+        push_edge(&list, v, random_below(&state, v), random_below(&state, max_weight + 1));
+    }
+
+    for (long long e = vertices - 1; e < target; e++) {
+        int src = random_below(&state, vertices);
+        int dest = random_below(&state, vertices);
+        if (src != dest) {
+            push_edge(&list, src, dest, random_below(&state, max_weight + 1));
+        }
+    }
+
+    debug_print("Generated Erdos-Renyi graph: %d vertices, %d edges", vertices, list.count);
+    return build_from_list(vertices, &list);
+}
+
+CSRGraph* generate_grid(int rows, int cols, int max_weight, unsigned long long seed) {
+    if (rows <= 0 || cols <= 0 || rows > INT_MAX / cols) {
+        error_exit("Invalid grid dimensions");
+    }
+
+    int vertices = rows * cols;
+    check_parameters(vertices, max_weight);
+
+    EdgeList list;
+    init_edge_list(&list, (long long)rows * (cols - 1) + (long long)(rows - 1) * cols);
+    unsigned long long state = seed;
+
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int v = r * cols + c;
+            if (c + 1 < cols) {
+                push_edge(&list, v, v + 1, random_below(&state, max_weight + 1));
+            }
+            if (r + 1 < rows) {
+                push_edge(&list, v, v + cols, random_below(&state, max_weight + 1));
+            }
+        }
+    }
+
+    debug_print("Generated %dx%d grid graph", rows, cols);
+    return build_from_list(vertices, &list);
+}
+
+CSRGraph* generate_geometric(int vertices, double avg_degree, int max_weight,
+                             unsigned long long seed) {
+    check_parameters(vertices, max_weight);
+
+    double radius = sqrt(avg_degree / (3.14159265358979323846 * vertices));
+    if (radius > 1.0 || radius <= 0.0) {
+        radius = 1.0;
+    }
+
+    int cells = (int)(1.0 / radius);
+    if (cells < 1) {
+        cells = 1;
+    }
+    if (cells > 4096) {
+        cells = 4096;
+    }
+
+    double* x = (double*)safe_malloc(vertices * sizeof(double));
+    double* y = (double*)safe_malloc(vertices * sizeof(double));
+    int* cell_start = (int*)safe_malloc(((size_t)cells * cells + 1) * sizeof(int));
+    int* order = (int*)safe_malloc(vertices * sizeof(int));
+    int* cell_of = (int*)safe_malloc(vertices * sizeof(int));
+
+    unsigned long long state = seed;
+    for (size_t c = 0; c <= (size_t)cells * cells; c++) {
+        cell_start[c] = 0;
+    }
+
+    for (int v = 0; v < vertices; v++) {
+        x[v] = random_unit(&state);
+        y[v] = random_unit(&state);
+        int cx = (int)(x[v] * cells);
+        int cy = (int)(y[v] * cells);
+        cell_of[v] = cy * cells + cx;
+        cell_start[cell_of[v] + 1]++;
+    }
+
+    for (size_t c = 0; c < (size_t)cells * cells; c++) {
+        cell_start[c + 1] += cell_start[c];
+    }
+
+    int* cursor = (int*)safe_malloc((size_t)cells * cells * sizeof(int));
+    for (size_t c = 0; c < (size_t)cells * cells; c++) {
+        cursor[c] = cell_start[c];
+    }
+    for (int v = 0; v < vertices; v++) {
+        order[cursor[cell_of[v]]++] = v;
+    }
+    safe_free((void**)&cursor);
+
+    EdgeList list;
+    init_edge_list(&list, (long long)(vertices * avg_degree / 2.0) + vertices);
+
+    for (int i = 1; i < vertices; i++) {
+        int a = order[i - 1];
+        int b = order[i];
+        double distance = sqrt((x[a] - x[b]) * (x[a] - x[b]) + (y[a] - y[b]) * (y[a] - y[b]));
+        double scaled = distance / radius * max_weight;
+        push_edge(&list, a, b, scaled > max_weight ? max_weight : (int)scaled);
+    }
+
+    for (int u = 0; u < vertices; u++) {
+        int cx = cell_of[u] % cells;
+        int cy = cell_of[u] / cells;
+
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                int nx = cx + dx;
+                int ny = cy + dy;
+                if (nx < 0 || ny < 0 || nx >= cells || ny >= cells) {
+                    continue;
+                }
+
+                int cell = ny * cells + nx;
+                for (int k = cell_start[cell]; k < cell_start[cell + 1]; k++) {
+                    int v = order[k];
+                    if (v <= u) {
+                        continue;
+                    }
+
+                    double distance = sqrt((x[u] - x[v]) * (x[u] - x[v]) + (y[u] - y[v]) * (y[u] - y[v]));
+                    if (distance <= radius) {
+                        push_edge(&list, u, v, (int)(distance / radius * max_weight));
+                    }
+                }
+            }
+        }
+    }
+
+    safe_free((void**)&x);
+    safe_free((void**)&y);
+    safe_free((void**)&cell_start);
+    safe_free((void**)&order);
+    safe_free((void**)&cell_of);
+
+    debug_print("Generated geometric graph: %d vertices, %d edges", vertices, list.count);
+    return build_from_list(vertices, &list);
+}
+
+Graph* generate_complete(int vertices, int max_weight, unsigned long long seed) {
+    check_parameters(vertices, max_weight);
+
+    Graph* graph = create_graph(vertices);
+    unsigned long long state = seed;
+
+    for (int i = 0; i < vertices; i++) {
+        int* row = graph_row(graph, i);
+        for (int j = i + 1; j < vertices; j++) {
+            int weight = random_below(&state, max_weight + 1);
+            row[j] = weight;
+            graph_row(graph, j)[i] = weight;
+        }
+    }
+    graph->max_weight = max_weight;
+
+    debug_print("Generated complete graph with %d vertices", vertices);
+    return graph;
+}
\ No newline at end of file
@@ -1,47 +1,72 @@
-#include "graph.h"
+#include "graph_io.h"
 
 Graph* create_graph(int vertices) {
     if (vertices <= 0) {
         error_exit("Number of vertices must be positive");
     }
 
+    int row_align = CACHE_LINE_SIZE / (int)sizeof(int);
+    if (vertices > INT_MAX - row_align) {
+        error_exit("Number of vertices is too large");
+    }
+
     Graph* graph = (Graph*)safe_malloc(sizeof(Graph));
     graph->vertices = vertices;
+    graph->max_weight = 0;
+    graph->stride = (vertices + row_align - 1) / row_align * row_align;
+
+    size_t header = (size_t)vertices * sizeof(int*);
+    header = (header + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+    size_t cells = (size_t)vertices * graph->stride;
+
+    char* block = (char*)safe_aligned_malloc(CACHE_LINE_SIZE, header + cells * sizeof(int));
+    graph->adj_matrix = (int**)block;
+    graph->matrix = (int*)(block + header);
+    graph->mapping = NULL;
+    graph->mapping_size = 0;
+
+    for (size_t i = 0; i < cells; i++) {
+        graph->matrix[i] = INF;
+    }
 
-    graph->adj_matrix = (int**)safe_malloc(vertices * sizeof(int*));
     for (int i = 0; i < vertices; i++) {
-        graph->adj_matrix[i] = (int*)safe_malloc(vertices * sizeof(int));
-        for (int j = 0; j < vertices; j++) {
-            graph->adj_matrix[i][j] = (i == j) ? 0 : INF;
-        }
+        graph->adj_matrix[i] = graph_row(graph, i);
+        graph->adj_matrix[i][i] = 0;
     }
 
     debug_print("Created graph with %d vertices", vertices);
     return graph;
 }
 
-void add_edge(Graph* graph, int src, int dest, int weight) {
+bool add_edge(Graph* graph, int src, int dest, int weight) {
     if (!graph) {
         error_exit("Graph is NULL");
     }
 
     if (src < 0 || src >= graph->vertices || dest < 0 || dest >= graph->vertices) {
-        error_exit("Invalid vertex indices");
+        debug_print("Invalid vertex indices: %d -- %d", src, dest);
+        return false;
     }
 
-    if (weight < 0) {
-        error_exit("Weight cannot be negative");
+    if (weight < 0 || weight >= INF) {
+        debug_print("Weight out of range: %d", weight);
+        return false;
     }
 
     if (src == dest) {
         debug_print("Self-loop ignored: vertex %d", src);
-        return;
+        return true;
     }
 
-    graph->adj_matrix[src][dest] = weight;
-    graph->adj_matrix[dest][src] = weight;
+    graph_row(graph, src)[dest] = weight;
+    graph_row(graph, dest)[src] = weight;
+
+    if (weight > graph->max_weight) {
+        graph->max_weight = weight;
+    }
 
     debug_print("Added edge: %d -- %d (weight: %d)", src, dest, weight);
+    return true;
 }
 
 void print_graph(Graph* graph) {
@@ -58,12 +83,13 @@ void print_graph(Graph* graph) {
     printf("\n");
 
     for (int i = 0; i < graph->vertices; i++) {
+        const int* row = graph_row(graph, i);
         printf("%4d:", i);
         for (int j = 0; j < graph->vertices; j++) {
-            if (graph->adj_matrix[i][j] == INF) {
+            if (row[j] == INF) {
                 printf(" INF");
             } else {
-                printf("%4d", graph->adj_matrix[i][j]);
+                printf("%4d", row[j]);
             }
         }
         printf("\n");
@@ -94,9 +120,10 @@ bool is_connected(Graph* graph) {
 
     while (top >= 0) {
         int current = stack[top--];
+        const int* row = graph_row(graph, current);
 
         for (int i = 0; i < graph->vertices; i++) {
-            if (!visited[i] && graph->adj_matrix[current][i] != INF) {
+            if (!visited[i] && row[i] != INF) {
                 visited[i] = true;
                 stack[++top] = i;
                 visited_count++;
@@ -117,13 +144,190 @@ void destroy_graph(Graph* graph) {
         return;
     }
 
-    if (graph->adj_matrix) {
-        for (int i = 0; i < graph->vertices; i++) {
-            safe_free((void**)&graph->adj_matrix[i]);
+    safe_free((void**)&graph->adj_matrix);
+    unmap_graph_file(graph->mapping, graph->mapping_size);
+    graph->matrix = NULL;
+
+    debug_print("Destroyed graph with %d vertices", graph->vertices);
+    safe_free((void**)&graph);
+}
+
+CSRGraph* create_csr_graph(int vertices, int edge_count,
+                           const int* src, const int* dest, const int* weight) {
+    if (vertices <= 0) {
+        error_exit("Number of vertices must be positive");
+    }
+
+    if (edge_count < 0 || edge_count > INT_MAX / 2) {
+        error_exit("Invalid number of edges");
+    }
+
+    if (edge_count > 0 && (!src || !dest || !weight)) {
+        error_exit("Edge arrays are NULL");
+    }
+
+    CSRGraph* graph = (CSRGraph*)safe_malloc(sizeof(CSRGraph));
+    graph->vertices = vertices;
+    graph->edges = 0;
+    graph->max_weight = 0;
+    graph->mapping = NULL;
+    graph->mapping_size = 0;
+
+    graph->offsets = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    for (int i = 0; i <= vertices; i++) {
+        graph->offsets[i] = 0;
+    }
+
+    for (int i = 0; i < edge_count; i++) {
+        if (src[i] < 0 || src[i] >= vertices || dest[i] < 0 || dest[i] >= vertices ||
+            weight[i] < 0 || weight[i] >= INF) {
+            debug_print("Invalid edge %d: %d -- %d (weight: %d)", i, src[i], dest[i], weight[i]);
+            safe_free((void**)&graph->offsets);
+            safe_free((void**)&graph);
+            return NULL;
+        }
+
+        if (src[i] == dest[i]) {
+            debug_print("Self-loop ignored: vertex %d", src[i]);
+            continue;
+        }
+
+        graph->offsets[src[i] + 1]++;
+        graph->offsets[dest[i] + 1]++;
+        graph->edges++;
+
+        if (weight[i] > graph->max_weight) {
+            graph->max_weight = weight[i];
         }
-        safe_free((void**)&graph->adj_matrix);
     }
 
-    debug_print("Destroyed graph with %d vertices", graph->vertices);
+    for (int i = 0; i < vertices; i++) {
+        graph->offsets[i + 1] += graph->offsets[i];
+    }
+
+    int slots = 2 * graph->edges;
+    graph->neighbors = (int*)safe_malloc((slots > 0 ? slots : 1) * sizeof(int));
+    graph->weights = (int*)safe_malloc((slots > 0 ? slots : 1) * sizeof(int));
+
+    int* cursor = (int*)safe_malloc(vertices * sizeof(int));
+    for (int i = 0; i < vertices; i++) {
+        cursor[i] = graph->offsets[i];
+    }
+
+    for (int i = 0; i < edge_count; i++) {
+        if (src[i] == dest[i]) {
+            continue;
+        }
+
+        graph->neighbors[cursor[src[i]]] = dest[i];
+        graph->weights[cursor[src[i]]++] = weight[i];
+        graph->neighbors[cursor[dest[i]]] = src[i];
+        graph->weights[cursor[dest[i]]++] = weight[i];
+    }
+
+    safe_free((void**)&cursor);
+
+    debug_print("Created CSR graph with %d vertices and %d edges", vertices, graph->edges);
+    return graph;
+}
+
+CSRGraph* csr_from_graph(Graph* graph) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    int vertices = graph->vertices;
+    int edge_count = 0;
+
+    for (int i = 0; i < vertices; i++) {
+        const int* row = graph_row(graph, i);
+        for (int j = i + 1; j < vertices; j++) {
+            if (row[j] != INF) {
+                edge_count++;
+            }
+        }
+    }
+
+    int capacity = edge_count > 0 ? edge_count : 1;
+    int* src = (int*)safe_malloc(capacity * sizeof(int));
+    int* dest = (int*)safe_malloc(capacity * sizeof(int));
+    int* weight = (int*)safe_malloc(capacity * sizeof(int));
+
+    int e = 0;
+    for (int i = 0; i < vertices; i++) {
+        const int* row = graph_row(graph, i);
+        for (int j = i + 1; j < vertices; j++) {
+            if (row[j] != INF) {
+                src[e] = i;
+                dest[e] = j;
+                weight[e] = row[j];
+                e++;
+            }
+        }
+    }
+
+    CSRGraph* csr = create_csr_graph(vertices, edge_count, src, dest, weight);
+
+    safe_free((void**)&src);
+    safe_free((void**)&dest);
+    safe_free((void**)&weight);
+
+    return csr;
+}
+
+Graph* graph_from_csr(CSRGraph* csr) {
+    if (!csr) {
+        error_exit("Graph is NULL");
+    }
+
+    Graph* graph = create_graph(csr->vertices);
+
+    for (int u = 0; u < csr->vertices; u++) {
+        int* row = graph_row(graph, u);
+        for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+            int v = csr->neighbors[k];
+            if (csr->weights[k] < row[v]) {
+                row[v] = csr->weights[k];
+            }
+        }
+    }
+    graph->max_weight = csr->max_weight;
+
+    return graph;
+}
+
+int csr_edge_weight(CSRGraph* graph, int src, int dest) {
+    if (!graph || src < 0 || src >= graph->vertices || dest < 0 || dest >= graph->vertices) {
+        return INF;
+    }
+
+    if (src == dest) {
+        return 0;
+    }
+
+    int best = INF;
+    for (int e = graph->offsets[src]; e < graph->offsets[src + 1]; e++) {
+        if (graph->neighbors[e] == dest && graph->weights[e] < best) {
+            best = graph->weights[e];
+        }
+    }
+
+    return best;
+}
+
+void destroy_csr_graph(CSRGraph* graph) {
+    if (!graph) {
+        return;
+    }
+
+    if (graph->mapping) {
+        unmap_graph_file(graph->mapping, graph->mapping_size);
+    } else {
+        safe_free((void**)&graph->offsets);
+        safe_free((void**)&graph->neighbors);
+        safe_free((void**)&graph->weights);
+    }
+
+    debug_print("Destroyed CSR graph with %d vertices", graph->vertices);
     safe_free((void**)&graph);
 }
\ No newline at end of file
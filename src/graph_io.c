@@ -0,0 +1,1014 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "graph_io.h"
+#include "thread_pool.h"
+#include "instrument.h"
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static size_t align_section(size_t offset) {
+    return (offset + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+}
+
+static void io_error(const char* path, const char* message) {
+    fprintf(stderr, "Error: %s: %s\n", path, message);
+}
+
+static void csr_sections(int vertices, int edges, size_t* neighbors_at,
+                         size_t* weights_at, size_t* file_size) {
+    size_t offsets_at = sizeof(GraphFileHeader);
+    *neighbors_at = align_section(offsets_at + ((size_t)vertices + 1) * sizeof(int));
+    *weights_at = align_section(*neighbors_at + (size_t)2 * edges * sizeof(int));
+    *file_size = *weights_at + (size_t)2 * edges * sizeof(int);
+}
+
+static void init_header(GraphFileHeader* header, GraphFileLayout layout) {
+    memset(header, 0, sizeof(GraphFileHeader));
+    memcpy(header->magic, GRAPH_FILE_MAGIC, sizeof(GRAPH_FILE_MAGIC));
+    header->version = GRAPH_FILE_VERSION;
+    header->layout = layout;
+    header->endian_tag = GRAPH_FILE_ENDIAN_TAG;
+}
+
+static bool write_section(FILE* file, const void* data, size_t bytes, size_t at) {
+    static const char zeros[CACHE_LINE_SIZE] = {0};
+    long position = ftell(file);
+
+    if (position < 0 || (size_t)position > at) {
+        return false;
+    }
+
+    if ((size_t)position < at && fwrite(zeros, 1, at - (size_t)position, file) != at - (size_t)position) {
+        return false;
+    }
+
+    return bytes == 0 || fwrite(data, 1, bytes, file) == bytes;
+}
+
+bool save_graph_binary(const char* path, Graph* graph) {
+    if (!path || !graph) {
+        return false;
+    }
+
+    GraphFileHeader header;
+    init_header(&header, GRAPH_FILE_DENSE);
+    header.vertices = graph->vertices;
+    header.max_weight = graph->max_weight;
+    header.stride = graph->stride;
+
+    size_t matrix_bytes = (size_t)graph->vertices * graph->stride * sizeof(int);
+    header.file_size = sizeof(GraphFileHeader) + matrix_bytes;
+
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        io_error(path, "cannot open file for writing");
+        return false;
+    }
+
+    bool ok = write_section(file, &header, sizeof(header), 0) &&
+              write_section(file, graph->matrix, matrix_bytes, sizeof(GraphFileHeader));
+
+    if (fclose(file) != 0 || !ok) {
+        io_error(path, "write failed");
+        return false;
+    }
+
+    debug_print("Saved dense graph with %d vertices to %s", graph->vertices, path);
+    return true;
+}
+
+bool save_csr_graph_binary(const char* path, CSRGraph* graph) {
+    if (!path || !graph) {
+        return false;
+    }
+
+    GraphFileHeader header;
+    init_header(&header, GRAPH_FILE_CSR);
+    header.vertices = graph->vertices;
+    header.edges = graph->edges;
+    header.max_weight = graph->max_weight;
+
+    size_t neighbors_at, weights_at, file_size;
+    csr_sections(graph->vertices, graph->edges, &neighbors_at, &weights_at, &file_size);
+    header.file_size = file_size;
+
+    size_t slot_bytes = (size_t)2 * graph->edges * sizeof(int);
+
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        io_error(path, "cannot open file for writing");
+        return false;
+    }
+
+    bool ok = write_section(file, &header, sizeof(header), 0) &&
+              write_section(file, graph->offsets, ((size_t)graph->vertices + 1) * sizeof(int),
+                            sizeof(GraphFileHeader)) &&
+              write_section(file, graph->neighbors, slot_bytes, neighbors_at) &&
+              write_section(file, graph->weights, slot_bytes, weights_at);
+
+    if (fclose(file) != 0 || !ok) {
+        io_error(path, "write failed");
+        return false;
+    }
+
+    debug_print("Saved CSR graph with %d vertices and %d edges to %s",
+               graph->vertices, graph->edges, path);
+    return true;
+}
+
+static bool read_header(const char* path, int fd, GraphFileHeader* header, size_t* file_size) {
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        io_error(path, "cannot stat file");
+        return false;
+    }
+
+    if ((size_t)info.st_size < sizeof(GraphFileHeader) ||
+        pread(fd, header, sizeof(GraphFileHeader), 0) != (ssize_t)sizeof(GraphFileHeader)) {
+        io_error(path, "file too small for graph header");
+        return false;
+    }
+
+    if (memcmp(header->magic, GRAPH_FILE_MAGIC, sizeof(GRAPH_FILE_MAGIC)) != 0) {
+        io_error(path, "not a binary graph file");
+        return false;
+    }
+
+    if (header->endian_tag != GRAPH_FILE_ENDIAN_TAG) {
+        io_error(path, "graph file has foreign byte order");
+        return false;
+    }
+
+    if (header->version != GRAPH_FILE_VERSION) {
+        io_error(path, "unsupported graph file version");
+        return false;
+    }
+
+    if (header->file_size != (uint64_t)info.st_size) {
+        io_error(path, "graph file is truncated");
+        return false;
+    }
+
+    *file_size = (size_t)info.st_size;
+    return true;
+}
+
+static void* map_graph_file(const char* path, GraphFileLayout layout,
+                            GraphFileHeader* header, size_t* size) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        io_error(path, "cannot open file");
+        return NULL;
+    }
+
+    if (!read_header(path, fd, header, size)) {
+        close(fd);
+        return NULL;
+    }
+
+    if (header->layout != (uint32_t)layout) {
+        io_error(path, "graph file has a different layout");
+        close(fd);
+        return NULL;
+    }
+
+    void* mapping = mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        io_error(path, "mmap failed");
+        return NULL;
+    }
+
+    return mapping;
+}
+
+static const char* check_csr_arrays(int vertices, int max_weight, const int* offsets,
+                                    const int* neighbors, const int* weights) {
+    if (max_weight < 0 || max_weight >= INF) {
+        return "maximum weight out of range";
+    }
+
+    for (int u = 0; u < vertices; u++) {
+        if (offsets[u + 1] < offsets[u]) {
+            return "CSR offsets decrease";
+        }
+    }
+
+    for (int k = 0; k < offsets[vertices]; k++) {
+        if (neighbors[k] < 0 || neighbors[k] >= vertices) {
+            return "neighbor index out of range";
+        }
+        if (weights[k] < 0 || weights[k] >= INF || weights[k] > max_weight) {
+            return "edge weight out of range";
+        }
+    }
+
+    return NULL;
+}
+
+#define SYMMETRY_SCAN_MAX 32
+#define SYMMETRY_TILE 64
+
+static const char* check_csr_edge_count(int vertices, int edges, const int* offsets,
+                                        const int* neighbors) {
+    int forward = 0;
+
+    for (int u = 0; u < vertices; u++) {
+        for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+            forward += neighbors[k] > u;
+        }
+    }
+
+    return forward == edges ? NULL : "edge count does not match the CSR arrays";
+}
+
+static bool take_reverse_arc(uint64_t* reverse, int begin, int end, int neighbor, int weight) {
+    uint64_t source = (uint64_t)(uint32_t)neighbor << 32;
+    uint64_t wanted = source | (uint32_t)weight;
+    uint64_t taken = source | UINT32_MAX;
+    int lo = begin;
+
+    if (end - begin > SYMMETRY_SCAN_MAX) {
+        int hi = end;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (reverse[mid] < source) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+    }
+
+    for (int k = lo; k < end && reverse[k] <= taken; k++) {
+        if (reverse[k] == wanted) {
+            reverse[k] = taken;
+            return true;
+        }
+    }
+    return false;
+}
+
+static const char* check_csr_symmetry(int vertices, const int* offsets, const int* neighbors,
+                                      const int* weights) {
+    int arcs = offsets[vertices];
+    int* fill = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    const char* problem = NULL;
+
+    for (int v = 0; v <= vertices; v++) {
+        fill[v] = 0;
+    }
+    for (int k = 0; k < arcs; k++) {
+        fill[neighbors[k]]++;
+    }
+    for (int v = 0; v < vertices && !problem; v++) {
+        if (fill[v] != offsets[v + 1] - offsets[v]) {
+            problem = "CSR adjacency is not symmetric";
+        }
+        fill[v] = offsets[v];
+    }
+
+    if (!problem) {
+        uint64_t* reverse = (uint64_t*)safe_malloc((arcs > 0 ? arcs : 1) * sizeof(uint64_t));
+
+        for (int u = 0; u < vertices; u++) {
+            uint64_t source = (uint64_t)(uint32_t)u << 32;
+            for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                reverse[fill[neighbors[k]]++] = source | (uint32_t)weights[k];
+            }
+        }
+
+        for (int v = 0; v < vertices && !problem; v++) {
+            for (int k = offsets[v]; k < offsets[v + 1]; k++) {
+                if (!take_reverse_arc(reverse, offsets[v], offsets[v + 1], neighbors[k], weights[k])) {
+                    problem = "CSR adjacency is not symmetric";
+                    break;
+                }
+            }
+        }
+
+        safe_free((void**)&reverse);
+    }
+
+    safe_free((void**)&fill);
+    return problem;
+}
+
+static const char* check_dense_header(const Graph* graph) {
+    if (graph->max_weight < 0 || graph->max_weight >= INF) {
+        return "maximum weight out of range";
+    }
+
+    for (int i = 0; i < graph->vertices; i++) {
+        if (graph_weight(graph, i, i) != 0) {
+            return "nonzero diagonal entry";
+        }
+    }
+
+    return NULL;
+}
+
+static const char* check_dense_matrix(const Graph* graph) {
+    int vertices = graph->vertices;
+
+    for (int bi = 0; bi < vertices; bi += SYMMETRY_TILE) {
+        int i_end = bi + SYMMETRY_TILE < vertices ? bi + SYMMETRY_TILE : vertices;
+        for (int bj = bi; bj < vertices; bj += SYMMETRY_TILE) {
+            int j_end = bj + SYMMETRY_TILE < vertices ? bj + SYMMETRY_TILE : vertices;
+            for (int i = bi; i < i_end; i++) {
+                const int* row = graph_row(graph, i);
+                for (int j = bj > i + 1 ? bj : i + 1; j < j_end; j++) {
+                    int w = row[j];
+                    if (w != INF && (w < 0 || w > graph->max_weight)) {
+                        return "edge weight out of range";
+                    }
+                    if (graph_weight(graph, j, i) != w) {
+                        return "adjacency matrix is not symmetric";
+                    }
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+GraphFileLayout probe_graph_file(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return GRAPH_FILE_INVALID;
+    }
+
+    GraphFileHeader header;
+    struct stat info;
+    GraphFileLayout layout = GRAPH_FILE_INVALID;
+
+    if (fstat(fd, &info) == 0 && (size_t)info.st_size >= sizeof(GraphFileHeader) &&
+        pread(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header) &&
+        memcmp(header.magic, GRAPH_FILE_MAGIC, sizeof(GRAPH_FILE_MAGIC)) == 0 &&
+        (header.layout == GRAPH_FILE_CSR || header.layout == GRAPH_FILE_DENSE ||
+         header.layout == GRAPH_FILE_EDGES)) {
+        layout = (GraphFileLayout)header.layout;
+    }
+
+    close(fd);
+    return layout;
+}
+
+static Graph* load_dense(const char* path, bool verify) {
+    if (!path) {
+        return NULL;
+    }
+
+    GraphFileHeader header;
+    size_t size;
+    char* mapping = (char*)map_graph_file(path, GRAPH_FILE_DENSE, &header, &size);
+    if (!mapping) {
+        return NULL;
+    }
+
+    int row_align = CACHE_LINE_SIZE / (int)sizeof(int);
+    int vertices = header.vertices;
+
+    if (vertices <= 0 || vertices > INT_MAX - row_align ||
+        header.stride != (vertices + row_align - 1) / row_align * row_align ||
+        size != sizeof(GraphFileHeader) + (size_t)vertices * header.stride * sizeof(int)) {
+        io_error(path, "inconsistent dense graph header");
+        unmap_graph_file(mapping, size);
+        return NULL;
+    }
+
+    Graph* graph = (Graph*)safe_malloc(sizeof(Graph));
+    graph->vertices = vertices;
+    graph->max_weight = header.max_weight;
+    graph->stride = header.stride;
+    graph->matrix = (int*)(mapping + sizeof(GraphFileHeader));
+    graph->mapping = mapping;
+    graph->mapping_size = size;
+
+    graph->adj_matrix = (int**)safe_malloc(vertices * sizeof(int*));
+    for (int i = 0; i < vertices; i++) {
+        graph->adj_matrix[i] = graph_row(graph, i);
+    }
+
+    const char* problem = check_dense_header(graph);
+    if (!problem && verify) {
+        problem = check_dense_matrix(graph);
+    }
+    if (problem) {
+        io_error(path, problem);
+        destroy_graph(graph);
+        return NULL;
+    }
+
+    debug_print("Mapped dense graph with %d vertices from %s", vertices, path);
+    return graph;
+}
+
+static CSRGraph* load_csr(const char* path, bool verify) {
+    if (!path) {
+        return NULL;
+    }
+
+    GraphFileHeader header;
+    size_t size;
+    char* mapping = (char*)map_graph_file(path, GRAPH_FILE_CSR, &header, &size);
+    if (!mapping) {
+        return NULL;
+    }
+
+    size_t neighbors_at = 0, weights_at = 0, expected_size = 0;
+    bool valid = header.vertices > 0 && header.vertices < INT_MAX &&
+                 header.edges >= 0 && header.edges <= INT_MAX / 2;
+
+    if (valid) {
+        csr_sections(header.vertices, header.edges, &neighbors_at, &weights_at, &expected_size);
+        const int* offsets = (const int*)(mapping + sizeof(GraphFileHeader));
+        valid = expected_size == size && offsets[0] == 0 &&
+                offsets[header.vertices] == 2 * header.edges;
+    }
+
+    if (!valid) {
+        io_error(path, "inconsistent CSR graph header");
+        unmap_graph_file(mapping, size);
+        return NULL;
+    }
+
+    const int* offsets = (const int*)(mapping + sizeof(GraphFileHeader));
+    const int* neighbors = (const int*)(mapping + neighbors_at);
+    const int* weights = (const int*)(mapping + weights_at);
+    const char* problem = check_csr_arrays(header.vertices, header.max_weight,
+                                           offsets, neighbors, weights);
+    if (!problem) {
+        problem = check_csr_edge_count(header.vertices, header.edges, offsets, neighbors);
+    }
+    if (!problem && verify) {
+        problem = check_csr_symmetry(header.vertices, offsets, neighbors, weights);
+    }
+    if (problem) {
+        io_error(path, problem);
+        unmap_graph_file(mapping, size);
+        return NULL;
+    }
+
+    CSRGraph* graph = (CSRGraph*)safe_malloc(sizeof(CSRGraph));
+    graph->vertices = header.vertices;
+    graph->edges = header.edges;
+    graph->max_weight = header.max_weight;
+    graph->offsets = (int*)(mapping + sizeof(GraphFileHeader));
+    graph->neighbors = (int*)(mapping + neighbors_at);
+    graph->weights = (int*)(mapping + weights_at);
+    graph->mapping = mapping;
+    graph->mapping_size = size;
+
+    debug_print("Mapped CSR graph with %d vertices and %d edges from %s",
+               graph->vertices, graph->edges, path);
+    return graph;
+}
+
+Graph* load_graph_binary(const char* path) {
+    return load_dense(path, false);
+}
+
+Graph* load_graph_binary_verified(const char* path) {
+    return load_dense(path, true);
+}
+
+CSRGraph* load_csr_graph_binary(const char* path) {
+    return load_csr(path, false);
+}
+
+CSRGraph* load_csr_graph_binary_verified(const char* path) {
+    return load_csr(path, true);
+}
+
+void unmap_graph_file(void* mapping, size_t size) {
+    if (mapping) {
+        munmap(mapping, size);
+    }
+}
+
+#define PARSE_PARALLEL_MIN_BYTES (1 << 20)
+#define READ_BLOCK_SIZE (1 << 16)
+
+typedef struct EdgeBuffer {
+    int *src;
+    int *dest;
+    int *weight;
+    int count;
+    int capacity;
+} EdgeBuffer;
+
+typedef struct ParseChunk {
+    const char *begin;
+    const char *end;
+    EdgeBuffer edges;
+    int max_vertex;
+    int declared_vertices;
+    const char *error;
+    const char *error_at;
+} ParseChunk;
+
+typedef struct ParseJob {
+    EdgeListFormat format;
+    ParseChunk *chunks;
+} ParseJob;
+
+static void push_edge(EdgeBuffer* buffer, int src, int dest, int weight) {
+    if (buffer->count == buffer->capacity) {
+        buffer->capacity = buffer->capacity > 0 ? buffer->capacity * 2 : 1024;
+        buffer->src = (int*)safe_realloc(buffer->src, buffer->capacity * sizeof(int));
+        buffer->dest = (int*)safe_realloc(buffer->dest, buffer->capacity * sizeof(int));
+        buffer->weight = (int*)safe_realloc(buffer->weight, buffer->capacity * sizeof(int));
+    }
+
+    buffer->src[buffer->count] = src;
+    buffer->dest[buffer->count] = dest;
+    buffer->weight[buffer->count] = weight;
+    buffer->count++;
+}
+
+static bool is_separator(char c) {
+    return c == ' ' || c == '\t' || c == ',' || c == ';' || c == '\r';
+}
+
+static int parse_fields(const char** cursor, const char* end, long long* values, int max_values) {
+    const char* p = *cursor;
+    int count = 0;
+
+    while (count < max_values) {
+        while (p < end && is_separator(*p)) {
+            p++;
+        }
+
+        bool negative = false;
+        if (p < end && *p == '-') {
+            negative = true;
+            p++;
+        }
+
+        if (p >= end || *p < '0' || *p > '9') {
+            break;
+        }
+
+        long long value = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            if (value <= INT_MAX) {
+                value = value * 10 + (*p - '0');
+            }
+            p++;
+        }
+
+        values[count++] = negative ? -value : value;
+    }
+
+    *cursor = p;
+    return count;
+}
+
+static void parse_chunk(ParseChunk* chunk, EdgeListFormat format) {
+    const char* p = chunk->begin;
+    const char* end = chunk->end;
+    long long values[3];
+
+    while (p < end && !chunk->error) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            p++;
+        }
+        if (p == end) {
+            break;
+        }
+
+        const char* line = p;
+        char lead = *p;
+        int count = -1;
+
+        if (format == EDGE_FORMAT_DIMACS) {
+            if (lead == 'a' || lead == 'p') {
+                p++;
+                if (lead == 'p') {
+                    while (p < end && is_separator(*p)) {
+                        p++;
+                    }
+                    while (p < end && *p >= 'a' && *p <= 'z') {
+                        p++;
+                    }
+                }
+                count = parse_fields(&p, end, values, lead == 'p' ? 2 : 3);
+            }
+        } else if (lead == '-' || (lead >= '0' && lead <= '9')) {
+            count = parse_fields(&p, end, values, 3);
+        }
+
+        while (p < end && *p != '\n') {
+            p++;
+        }
+        p++;
+
+        if (count < 0) {
+            continue;
+        }
+
+        if (format == EDGE_FORMAT_DIMACS && lead == 'p') {
+            if (count < 1 || values[0] <= 0 || values[0] > INT_MAX) {
+                chunk->error = "malformed problem line";
+                chunk->error_at = line;
+            } else {
+                chunk->declared_vertices = (int)values[0];
+            }
+            continue;
+        }
+
+        if ((format == EDGE_FORMAT_DIMACS && count != 3) || count < 2) {
+            chunk->error = "malformed edge line";
+            chunk->error_at = line;
+            continue;
+        }
+
+        long long base = (format == EDGE_FORMAT_DIMACS) ? 1 : 0;
+        long long src = values[0] - base;
+        long long dest = values[1] - base;
+        long long weight = (count == 3) ? values[2] : 1;
+
+        if (src < 0 || dest < 0 || src >= INT_MAX || dest >= INT_MAX) {
+            chunk->error = "vertex index out of range";
+            chunk->error_at = line;
+            continue;
+        }
+
+        if (weight < 0 || weight >= INF) {
+            chunk->error = "weight out of range";
+            chunk->error_at = line;
+            continue;
+        }
+
+        if (src > chunk->max_vertex) {
+            chunk->max_vertex = (int)src;
+        }
+        if (dest > chunk->max_vertex) {
+            chunk->max_vertex = (int)dest;
+        }
+
+        push_edge(&chunk->edges, (int)src, (int)dest, (int)weight);
+    }
+}
+
+static void parse_chunk_task(void* arg, int thread_id, int thread_count) {
+    ParseJob* job = (ParseJob*)arg;
+    (void)thread_count;
+    parse_chunk(&job->chunks[thread_id], job->format);
+}
+
+static int arc_low(const int* src, const int* dest, int i) {
+    return src[i] < dest[i] ? src[i] : dest[i];
+}
+
+static int arc_high(const int* src, const int* dest, int i) {
+    return src[i] < dest[i] ? dest[i] : src[i];
+}
+
+static int pair_dimacs_arcs(int vertices, int count, int* src, int* dest, int* weight) {
+    int* offsets = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    int* by_high = (int*)safe_malloc((count > 0 ? count : 1) * sizeof(int));
+    int* order = (int*)safe_malloc((count > 0 ? count : 1) * sizeof(int));
+
+    for (int i = 0; i <= vertices; i++) {
+        offsets[i] = 0;
+    }
+    for (int i = 0; i < count; i++) {
+        offsets[arc_high(src, dest, i) + 1]++;
+    }
+    for (int i = 0; i < vertices; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    for (int i = 0; i < count; i++) {
+        by_high[offsets[arc_high(src, dest, i)]++] = i;
+    }
+
+    for (int i = 0; i <= vertices; i++) {
+        offsets[i] = 0;
+    }
+    for (int i = 0; i < count; i++) {
+        offsets[arc_low(src, dest, i) + 1]++;
+    }
+    for (int i = 0; i < vertices; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    for (int k = 0; k < count; k++) {
+        int i = by_high[k];
+        order[offsets[arc_low(src, dest, i)]++] = i;
+    }
+
+    int* state = by_high;
+    for (int i = 0; i < count; i++) {
+        state[i] = 0;
+    }
+
+    int begin = 0;
+    while (begin < count) {
+        int low = arc_low(src, dest, order[begin]);
+        int high = arc_high(src, dest, order[begin]);
+        int finish = begin + 1;
+        while (finish < count && arc_low(src, dest, order[finish]) == low &&
+               arc_high(src, dest, order[finish]) == high) {
+            finish++;
+        }
+
+        for (int k = begin; k < finish; k++) {
+            int i = order[k];
+            if (src[i] <= dest[i]) {
+                continue;
+            }
+            for (int m = begin; m < finish; m++) {
+                int j = order[m];
+                if (src[j] < dest[j] && state[j] == 0 && weight[j] == weight[i]) {
+                    state[j] = 1;
+                    state[i] = 2;
+                    break;
+                }
+            }
+        }
+        begin = finish;
+    }
+
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        if (state[i] != 2) {
+            src[kept] = src[i];
+            dest[kept] = dest[i];
+            weight[kept] = weight[i];
+            kept++;
+        }
+    }
+
+    debug_print("DIMACS: %d arcs paired into %d edges", count, kept);
+
+    safe_free((void**)&offsets);
+    safe_free((void**)&by_high);
+    safe_free((void**)&order);
+    return kept;
+}
+
+EdgeListFormat detect_edge_list_format(const char* path, const char* data, size_t size) {
+    if (path) {
+        size_t length = strlen(path);
+        if (length >= 3 && strcmp(path + length - 3, ".gr") == 0) {
+            return EDGE_FORMAT_DIMACS;
+        }
+        if (length >= 4 && strcmp(path + length - 4, ".csv") == 0) {
+            return EDGE_FORMAT_CSV;
+        }
+    }
+
+    size_t i = 0;
+    while (i < size) {
+        while (i < size && (data[i] == ' ' || data[i] == '\t' || data[i] == '\r' || data[i] == '\n')) {
+            i++;
+        }
+        if (i >= size) {
+            break;
+        }
+
+        if ((data[i] == 'c' || data[i] == 'p' || data[i] == 'a') &&
+            i + 1 < size && (data[i + 1] == ' ' || data[i + 1] == '\t')) {
+            return EDGE_FORMAT_DIMACS;
+        }
+
+        if (data[i] >= '0' && data[i] <= '9') {
+            while (i < size && data[i] != '\n') {
+                if (data[i] == ',') {
+                    return EDGE_FORMAT_CSV;
+                }
+                i++;
+            }
+            return EDGE_FORMAT_SNAP;
+        }
+
+        while (i < size && data[i] != '\n') {
+            i++;
+        }
+    }
+
+    return EDGE_FORMAT_SNAP;
+}
+
+CSRGraph* parse_edge_list(const char* data, size_t size, EdgeListFormat format, int thread_count) {
+    if (!data && size > 0) {
+        return NULL;
+    }
+
+    if (format == EDGE_FORMAT_AUTO) {
+        format = detect_edge_list_format(NULL, data, size);
+    }
+
+    if (thread_count <= 0) {
+        thread_count = thread_pool_default_size();
+    }
+    if (size < PARSE_PARALLEL_MIN_BYTES) {
+        thread_count = 1;
+    }
+
+    ParseChunk* chunks = (ParseChunk*)safe_malloc(thread_count * sizeof(ParseChunk));
+    const char* end = data + size;
+
+    for (int t = 0; t < thread_count; t++) {
+        const char* begin = data + size / thread_count * t;
+        if (t > 0) {
+            while (begin < end && begin[-1] != '\n') {
+                begin++;
+            }
+        }
+
+        memset(&chunks[t], 0, sizeof(ParseChunk));
+        chunks[t].begin = begin;
+        chunks[t].max_vertex = -1;
+        chunks[t].declared_vertices = -1;
+        if (t > 0) {
+            chunks[t - 1].end = begin;
+        }
+    }
+    chunks[thread_count - 1].end = end;
+
+    ParseJob job;
+    job.format = format;
+    job.chunks = chunks;
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_IO);
+    if (thread_count > 1) {
+        ThreadPool* pool = create_thread_pool(thread_count);
+        thread_pool_run(pool, parse_chunk_task, &job);
+        destroy_thread_pool(pool);
+    } else {
+        parse_chunk(&chunks[0], format);
+    }
+    INSTR_PHASE_END(INSTR_PHASE_IO);
+
+    const char* error = NULL;
+    const char* error_at = NULL;
+    long long total = 0;
+    int max_vertex = -1;
+    int declared_vertices = -1;
+
+    for (int t = 0; t < thread_count; t++) {
+        if (chunks[t].error && !error) {
+            error = chunks[t].error;
+            error_at = chunks[t].error_at;
+        }
+        total += chunks[t].edges.count;
+        if (chunks[t].max_vertex > max_vertex) {
+            max_vertex = chunks[t].max_vertex;
+        }
+        if (chunks[t].declared_vertices > 0) {
+            declared_vertices = chunks[t].declared_vertices;
+        }
+    }
+
+    int vertices = declared_vertices > 0 ? declared_vertices : max_vertex + 1;
+
+    if (!error && total > INT_MAX / 2) {
+        error = "too many edges";
+    }
+    if (!error && vertices <= 0) {
+        error = "no vertices found";
+    }
+    if (!error && max_vertex >= vertices) {
+        error = "edge endpoint exceeds declared vertex count";
+    }
+
+    CSRGraph* graph = NULL;
+
+    if (error) {
+        if (error_at) {
+            fprintf(stderr, "Error: edge list byte %ld: %s\n", (long)(error_at - data), error);
+        } else {
+            fprintf(stderr, "Error: edge list: %s\n", error);
+        }
+    } else {
+        int slots = total > 0 ? (int)total : 1;
+        int* src = (int*)safe_malloc(slots * sizeof(int));
+        int* dest = (int*)safe_malloc(slots * sizeof(int));
+        int* weight = (int*)safe_malloc(slots * sizeof(int));
+
+        int next = 0;
+        for (int t = 0; t < thread_count; t++) {
+            EdgeBuffer* buffer = &chunks[t].edges;
+            memcpy(src + next, buffer->src, buffer->count * sizeof(int));
+            memcpy(dest + next, buffer->dest, buffer->count * sizeof(int));
+            memcpy(weight + next, buffer->weight, buffer->count * sizeof(int));
+            next += buffer->count;
+        }
+
+        int edge_count = (int)total;
+        if (format == EDGE_FORMAT_DIMACS) {
+            edge_count = pair_dimacs_arcs(vertices, edge_count, src, dest, weight);
+        }
+
+        graph = create_csr_graph(vertices, edge_count, src, dest, weight);
+
+        safe_free((void**)&src);
+        safe_free((void**)&dest);
+        safe_free((void**)&weight);
+    }
+
+    for (int t = 0; t < thread_count; t++) {
+        safe_free((void**)&chunks[t].edges.src);
+        safe_free((void**)&chunks[t].edges.dest);
+        safe_free((void**)&chunks[t].edges.weight);
+    }
+    safe_free((void**)&chunks);
+
+    return graph;
+}
+
+static char* read_stream(FILE* stream, size_t* size) {
+    size_t capacity = READ_BLOCK_SIZE;
+    size_t length = 0;
+    char* buffer = (char*)safe_malloc(capacity);
+
+    while (true) {
+        if (length == capacity) {
+            capacity *= 2;
+            buffer = (char*)safe_realloc(buffer, capacity);
+        }
+
+        size_t read = fread(buffer + length, 1, capacity - length, stream);
+        length += read;
+        if (read == 0) {
+            break;
+        }
+    }
+
+    *size = length;
+    return buffer;
+}
+
+CSRGraph* load_edge_list(const char* path, EdgeListFormat format, int thread_count) {
+    if (!path || strcmp(path, "-") == 0) {
+        size_t size;
+        char* data = read_stream(stdin, &size);
+        CSRGraph* graph = parse_edge_list(data, size, format, thread_count);
+        safe_free((void**)&data);
+        return graph;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        io_error(path, "cannot open file");
+        return NULL;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        io_error(path, "cannot stat file");
+        close(fd);
+        return NULL;
+    }
+
+    char* data = NULL;
+    size_t size = (size_t)info.st_size;
+    void* mapping = NULL;
+
+    if (S_ISREG(info.st_mode) && size > 0) {
+        mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            io_error(path, "mmap failed");
+            close(fd);
+            return NULL;
+        }
+        posix_madvise(mapping, size, POSIX_MADV_SEQUENTIAL);
+        data = (char*)mapping;
+    } else {
+        FILE* stream = fdopen(fd, "rb");
+        if (!stream) {
+            io_error(path, "cannot read file");
+            close(fd);
+            return NULL;
+        }
+        data = read_stream(stream, &size);
+        fclose(stream);
+        fd = -1;
+    }
+
+    if (fd >= 0) {
+        close(fd);
+    }
+
+    if (format == EDGE_FORMAT_AUTO) {
+        format = detect_edge_list_format(path, data, size);
+    }
+
+    CSRGraph* graph = parse_edge_list(data, size, format, thread_count);
+
+    if (mapping) {
+        munmap(mapping, size);
+    } else {
+        safe_free((void**)&data);
+    }
+
+    debug_print("Loaded edge list %s", path);
+    return graph;
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "instrument.h"
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+static pthread_mutex_t instrument_lock = PTHREAD_MUTEX_INITIALIZER;
+static InstrumentBlock* instrument_blocks = NULL;
+static InstrumentBlock instrument_retired;
+
+static const char* counter_names[INSTR_COUNTER_COUNT] = {
+    "heap_inserts",
+    "heap_extracts",
+    "heap_sifts",
+    "decrease_keys",
+    "comparisons",
+    "relax_scanned",
+    "relax_taken"
+};
+
+static const char* phase_names[INSTR_PHASE_COUNT] = {
+    "setup",
+    "solve",
+    "merge",
+    "io"
+};
+
+#ifdef PRIM_INSTRUMENT
+
+__thread InstrumentBlock* instrument_local = NULL;
+static InstrumentBlock* instrument_free_blocks = NULL;
+static int instrument_thread_count = 0;
+static pthread_once_t instrument_once = PTHREAD_ONCE_INIT;
+static pthread_key_t instrument_key;
+
+static void retire_block(void* arg) {
+    InstrumentBlock* block = (InstrumentBlock*)arg;
+
+    pthread_mutex_lock(&instrument_lock);
+    for (int c = 0; c < INSTR_COUNTER_COUNT; c++) {
+        instrument_retired.counters[c] += block->counters[c];
+    }
+    for (int p = 0; p < INSTR_PHASE_COUNT; p++) {
+        instrument_retired.phase_ns[p] += block->phase_ns[p];
+    }
+
+    InstrumentBlock** link = &instrument_blocks;
+    while (*link != block) {
+        link = &(*link)->next;
+    }
+    *link = block->next;
+
+    block->next = instrument_free_blocks;
+    instrument_free_blocks = block;
+    pthread_mutex_unlock(&instrument_lock);
+}
+
+static void create_instrument_key(void) {
+    pthread_key_create(&instrument_key, retire_block);
+}
+
+InstrumentBlock* instrument_register(void) {
+    pthread_once(&instrument_once, create_instrument_key);
+
+    pthread_mutex_lock(&instrument_lock);
+    InstrumentBlock* block = instrument_free_blocks;
+    if (block) {
+        instrument_free_blocks = block->next;
+    } else {
+        block = (InstrumentBlock*)safe_aligned_malloc(CACHE_LINE_SIZE, sizeof(InstrumentBlock));
+    }
+    memset(block, 0, sizeof(InstrumentBlock));
+    block->thread_index = instrument_thread_count++;
+    block->next = instrument_blocks;
+    instrument_blocks = block;
+    pthread_mutex_unlock(&instrument_lock);
+
+    pthread_setspecific(instrument_key, block);
+    instrument_local = block;
+    return block;
+}
+
+uint64_t instrument_clock(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+#endif
+
+bool instrument_enabled(void) {
+#ifdef PRIM_INSTRUMENT
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* instrument_counter_name(InstrumentCounter counter) {
+    return ((int)counter >= 0 && counter < INSTR_COUNTER_COUNT) ? counter_names[counter] : "unknown";
+}
+
+const char* instrument_phase_name(InstrumentPhase phase) {
+    return ((int)phase >= 0 && phase < INSTR_PHASE_COUNT) ? phase_names[phase] : "unknown";
+}
+
+void instrument_totals(InstrumentTotals* totals) {
+    if (!totals) {
+        return;
+    }
+
+    memset(totals, 0, sizeof(InstrumentTotals));
+
+    pthread_mutex_lock(&instrument_lock);
+    for (int c = 0; c < INSTR_COUNTER_COUNT; c++) {
+        totals->counters[c] = instrument_retired.counters[c];
+    }
+    for (int p = 0; p < INSTR_PHASE_COUNT; p++) {
+        totals->phase_ns[p] = instrument_retired.phase_ns[p];
+    }
+    for (InstrumentBlock* block = instrument_blocks; block; block = block->next) {
+        for (int c = 0; c < INSTR_COUNTER_COUNT; c++) {
+            totals->counters[c] += block->counters[c];
+        }
+        for (int p = 0; p < INSTR_PHASE_COUNT; p++) {
+            totals->phase_ns[p] += block->phase_ns[p];
+        }
+        totals->threads++;
+    }
+    pthread_mutex_unlock(&instrument_lock);
+}
+
+void instrument_reset(void) {
+    pthread_mutex_lock(&instrument_lock);
+    memset(&instrument_retired, 0, sizeof(InstrumentBlock));
+    for (InstrumentBlock* block = instrument_blocks; block; block = block->next) {
+        memset(block->counters, 0, sizeof(block->counters));
+        memset(block->phase_ns, 0, sizeof(block->phase_ns));
+    }
+    pthread_mutex_unlock(&instrument_lock);
+}
+
+static void dump_values(FILE* out, const uint64_t* counters, const uint64_t* phase_ns) {
+    fprintf(out, "{");
+    for (int c = 0; c < INSTR_COUNTER_COUNT; c++) {
+        fprintf(out, "\"%s\": %llu, ", counter_names[c], (unsigned long long)counters[c]);
+    }
+    fprintf(out, "\"phase_ns\": {");
+    for (int p = 0; p < INSTR_PHASE_COUNT; p++) {
+        fprintf(out, "%s\"%s\": %llu", p > 0 ? ", " : "", phase_names[p],
+                (unsigned long long)phase_ns[p]);
+    }
+    fprintf(out, "}}");
+}
+
+void instrument_dump_json(FILE* out) {
+    InstrumentTotals totals;
+    instrument_totals(&totals);
+
+    fprintf(out, "{\"enabled\": %s, \"threads\": %d, \"totals\": ",
+            instrument_enabled() ? "true" : "false", totals.threads);
+    dump_values(out, totals.counters, totals.phase_ns);
+    fprintf(out, ", \"per_thread\": [");
+
+    pthread_mutex_lock(&instrument_lock);
+    fprintf(out, "{\"thread\": \"retired\", \"values\": ");
+    dump_values(out, instrument_retired.counters, instrument_retired.phase_ns);
+    fprintf(out, "}");
+    for (InstrumentBlock* block = instrument_blocks; block; block = block->next) {
+        fprintf(out, ", {\"thread\": %d, \"values\": ", block->thread_index);
+        dump_values(out, block->counters, block->phase_ns);
+        fprintf(out, "}");
+    }
+    pthread_mutex_unlock(&instrument_lock);
+
+    fprintf(out, "]}\n");
+}
\ No newline at end of file
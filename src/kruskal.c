@@ -0,0 +1,324 @@
+#include "kruskal.h"
+#include "instrument.h"
+#include <string.h>
+
+#define RADIX_BITS 11
+#define RADIX_SIZE (1 << RADIX_BITS)
+
+typedef struct KruskalState {
+    UnionFind *uf;
+    int *src;
+    int *dest;
+    int *weight;
+    int tree_edges;
+    int target;
+    unsigned int seed;
+} KruskalState;
+
+UnionFind* create_union_find(int size) {
+    if (size < 0) {
+        error_exit("Invalid union-find size");
+    }
+
+    UnionFind* uf = (UnionFind*)safe_malloc(sizeof(UnionFind));
+    uf->parent = (int*)safe_malloc((size + 1) * sizeof(int));
+    uf->rank = (int*)safe_malloc((size + 1) * sizeof(int));
+    uf->size = size;
+    uf->sets = size;
+
+    for (int i = 0; i < size; i++) {
+        uf->parent[i] = i;
+        uf->rank[i] = 0;
+    }
+
+    return uf;
+}
+
+int union_find_find(UnionFind* uf, int x) {
+    int root = x;
+    while (uf->parent[root] != root) {
+        root = uf->parent[root];
+    }
+
+    while (uf->parent[x] != root) {
+        int next = uf->parent[x];
+        uf->parent[x] = root;
+        x = next;
+    }
+
+    return root;
+}
+
+bool union_find_union(UnionFind* uf, int a, int b) {
+    a = union_find_find(uf, a);
+    b = union_find_find(uf, b);
+    if (a == b) {
+        return false;
+    }
+
+    if (uf->rank[a] < uf->rank[b]) {
+        int temp = a;
+        a = b;
+        b = temp;
+    }
+
+    uf->parent[b] = a;
+    if (uf->rank[a] == uf->rank[b]) {
+        uf->rank[a]++;
+    }
+    uf->sets--;
+    return true;
+}
+
+void destroy_union_find(UnionFind* uf) {
+    if (uf) {
+        safe_free((void**)&uf->parent);
+        safe_free((void**)&uf->rank);
+        safe_free((void**)&uf);
+    }
+}
+
+void sort_kruskal_edges(KruskalEdge* edges, int count, int max_weight) {
+    if (!edges || count < 2) {
+        return;
+    }
+
+    if (max_weight < 0) {
+        max_weight = 0;
+        for (int i = 0; i < count; i++) {
+            if (edges[i].weight > max_weight) {
+                max_weight = edges[i].weight;
+            }
+        }
+    }
+
+    KruskalEdge* buffer = (KruskalEdge*)safe_malloc(count * sizeof(KruskalEdge));
+    int* histogram = (int*)safe_malloc(RADIX_SIZE * sizeof(int));
+    KruskalEdge* from = edges;
+    KruskalEdge* to = buffer;
+
+    for (int shift = 0; shift == 0 || (max_weight >> shift) > 0; shift += RADIX_BITS) {
+        memset(histogram, 0, RADIX_SIZE * sizeof(int));
+        for (int i = 0; i < count; i++) {
+            histogram[(from[i].weight >> shift) & (RADIX_SIZE - 1)]++;
+        }
+
+        int sum = 0;
+        for (int d = 0; d < RADIX_SIZE; d++) {
+            int c = histogram[d];
+            histogram[d] = sum;
+            sum += c;
+        }
+
+        for (int i = 0; i < count; i++) {
+            to[histogram[(from[i].weight >> shift) & (RADIX_SIZE - 1)]++] = from[i];
+        }
+
+        KruskalEdge* temp = from;
+        from = to;
+        to = temp;
+
+        if (shift + RADIX_BITS >= 31) {
+            break;
+        }
+    }
+
+    if (from != edges) {
+        memcpy(edges, from, count * sizeof(KruskalEdge));
+    }
+
+    safe_free((void**)&histogram);
+    safe_free((void**)&buffer);
+}
+
+static KruskalEdge* collect_edges(CSRGraph* graph, int* count) {
+    KruskalEdge* edges = (KruskalEdge*)safe_malloc(((size_t)graph->edges + 1) * sizeof(KruskalEdge));
+    int n = 0;
+
+    for (int u = 0; u < graph->vertices; u++) {
+        for (int k = graph->offsets[u]; k < graph->offsets[u + 1]; k++) {
+            int v = graph->neighbors[k];
+            if (v > u) {
+                edges[n].src = u;
+                edges[n].dest = v;
+                edges[n].weight = graph->weights[k];
+                n++;
+            }
+        }
+    }
+
+    *count = n;
+    return edges;
+}
+
+static void init_state(KruskalState* state, int vertices) {
+    state->uf = create_union_find(vertices);
+    state->src = (int*)safe_malloc(vertices * sizeof(int));
+    state->dest = (int*)safe_malloc(vertices * sizeof(int));
+    state->weight = (int*)safe_malloc(vertices * sizeof(int));
+    state->tree_edges = 0;
+    state->target = vertices - 1;
+    state->seed = 2463534242u;
+}
+
+static void scan_sorted(KruskalState* state, const KruskalEdge* edges, int count) {
+    for (int i = 0; i < count && state->tree_edges < state->target; i++) {
+        INSTR_COUNT(INSTR_RELAX_SCANNED);
+        if (union_find_union(state->uf, edges[i].src, edges[i].dest)) {
+            INSTR_COUNT(INSTR_RELAX_TAKEN);
+            state->src[state->tree_edges] = edges[i].src;
+            state->dest[state->tree_edges] = edges[i].dest;
+            state->weight[state->tree_edges] = edges[i].weight;
+            state->tree_edges++;
+        }
+    }
+}
+
+static MST_Result* finish_state(KruskalState* state, int vertices, int start_vertex) {
+    if (state->tree_edges != state->target) {
+        error_exit("Graph is not connected");
+    }
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_MERGE);
+    MST_Result* result = mst_result_from_edges(vertices, start_vertex, state->tree_edges,
+                                               state->src, state->dest, state->weight);
+    INSTR_PHASE_END(INSTR_PHASE_MERGE);
+
+    destroy_union_find(state->uf);
+    safe_free((void**)&state->src);
+    safe_free((void**)&state->dest);
+    safe_free((void**)&state->weight);
+    return result;
+}
+
+MST_Result* kruskal_mst(CSRGraph* graph, int start_vertex) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    if (start_vertex < 0 || start_vertex >= graph->vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SETUP);
+    int count;
+    KruskalEdge* edges = collect_edges(graph, &count);
+    sort_kruskal_edges(edges, count, graph->max_weight);
+
+    KruskalState state;
+    init_state(&state, graph->vertices);
+    INSTR_PHASE_END(INSTR_PHASE_SETUP);
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SOLVE);
+    scan_sorted(&state, edges, count);
+    INSTR_PHASE_END(INSTR_PHASE_SOLVE);
+
+    safe_free((void**)&edges);
+
+    MST_Result* result = finish_state(&state, graph->vertices, start_vertex);
+    debug_print("Kruskal MST total weight: %lld", result->total_weight);
+    return result;
+}
+
+static int sample_weight(KruskalState* state, const KruskalEdge* edges, int count) {
+    state->seed ^= state->seed << 13;
+    state->seed ^= state->seed >> 17;
+    state->seed ^= state->seed << 5;
+    return edges[state->seed % (unsigned int)count].weight;
+}
+
+static int choose_pivot(KruskalState* state, const KruskalEdge* edges, int count) {
+    int a = sample_weight(state, edges, count);
+    int b = sample_weight(state, edges, count);
+    int c = sample_weight(state, edges, count);
+
+    if (a > b) {
+        int temp = a;
+        a = b;
+        b = temp;
+    }
+    if (b > c) {
+        b = c;
+    }
+    return a > b ? a : b;
+}
+
+static int filter_edges(KruskalState* state, KruskalEdge* edges, int count) {
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        if (union_find_find(state->uf, edges[i].src) != union_find_find(state->uf, edges[i].dest)) {
+            edges[kept++] = edges[i];
+        }
+    }
+    return kept;
+}
+
+static void filter_kruskal_range(KruskalState* state, KruskalEdge* edges, int count, int max_weight) {
+    if (count <= 0 || state->tree_edges == state->target) {
+        return;
+    }
+
+    if (count <= FILTER_KRUSKAL_BASE) {
+        sort_kruskal_edges(edges, count, max_weight);
+        scan_sorted(state, edges, count);
+        return;
+    }
+
+    int pivot = choose_pivot(state, edges, count);
+    int lt = 0;
+    int i = 0;
+    int gt = count;
+
+    while (i < gt) {
+        int w = edges[i].weight;
+        if (w < pivot) {
+            KruskalEdge temp = edges[lt];
+            edges[lt++] = edges[i];
+            edges[i++] = temp;
+        } else if (w > pivot) {
+            KruskalEdge temp = edges[--gt];
+            edges[gt] = edges[i];
+            edges[i] = temp;
+        } else {
+            i++;
+        }
+    }
+
+    filter_kruskal_range(state, edges, lt, pivot - 1);
+    scan_sorted(state, edges + lt, gt - lt);
+
+    if (state->tree_edges == state->target) {
+        return;
+    }
+
+    int heavy = filter_edges(state, edges + gt, count - gt);
+    filter_kruskal_range(state, edges + gt, heavy, max_weight);
+}
+
+MST_Result* filter_kruskal_mst(CSRGraph* graph, int start_vertex) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    if (start_vertex < 0 || start_vertex >= graph->vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SETUP);
+    int count;
+    KruskalEdge* edges = collect_edges(graph, &count);
+
+    KruskalState state;
+    init_state(&state, graph->vertices);
+    INSTR_PHASE_END(INSTR_PHASE_SETUP);
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SOLVE);
+    filter_kruskal_range(&state, edges, count, graph->max_weight);
+    INSTR_PHASE_END(INSTR_PHASE_SOLVE);
+
+    safe_free((void**)&edges);
+
+    MST_Result* result = finish_state(&state, graph->vertices, start_vertex);
+    debug_print("Filter-Kruskal MST total weight: %lld", result->total_weight);
+    return result;
+}
\ No newline at end of file
@@ -1,4 +1,10 @@
 #include "prim.h"
+#include "prim_dense.h"
+#include "graph_io.h"
+#include "external_mst.h"
+#include "instrument.h"
+#include "kruskal.h"
+#include "mst_select.h"
 #include <time.h>
 
 void print_menu() {
@@ -7,7 +13,7 @@ void print_menu() {
     printf("2. Run Example 2 (Complete 5-vertex graph)\n");
     printf("3. Run Example 3 (Linear graph)\n");
     printf("4. Run Custom Graph\n");
-    printf("5. Compare Algorithms (Heap vs Simple)\n");
+    printf("5. Compare Algorithms (Heap vs Simple vs CSR vs Kruskal)\n");
     printf("0. Exit\n");
     printf("===================================\n");
     printf("Choose an option: ");
@@ -79,11 +85,7 @@ Graph* create_custom_graph() {
         printf("Edge %d: ", i + 1);
         scanf("%d %d %d", &src, &dest, &weight);
 
-        if (src >= 0 && src < vertices &&
-            dest >= 0 && dest < vertices &&
-            weight >= 0) {
-            add_edge(graph, src, dest, weight);
-        } else {
+        if (!add_edge(graph, src, dest, weight)) {
             printf("Invalid edge parameters. Skipping.\n");
             i--;
         }
@@ -126,17 +128,20 @@ void run_example(int example_num) {
     printf("\n=== %s ===\n", description);
     print_graph(graph);
 
-    if (!is_connected(graph)) {
-        printf("Warning: Graph is not connected. MST may not be complete.\n");
-        destroy_graph(graph);
-        return;
-    }
-
     printf("Running Prim's Algorithm (starting from vertex 0):\n");
 
-    MST_Result* result = prim_mst(graph, 0);
+    MST_Forest* forest = prim_msf(graph, 0);
+    MST_Result* result = forest->tree;
 
-    if (result) {
+    if (forest->component_count > 1) {
+        printf("Warning: Graph is not connected. Minimum spanning forest has %d components:\n",
+               forest->component_count);
+        for (int c = 0; c < forest->component_count; c++) {
+            printf("Component %d: root %d, weight %lld\n",
+                   c, forest->root[c], forest->component_weight[c]);
+        }
+        printf("Total forest weight: %lld\n", result->total_weight);
+    } else {
         print_mst(result);
 
         if (validate_mst(graph, result)) {
@@ -144,10 +149,9 @@ void run_example(int example_num) {
         } else {
             printf("\n✗ MST validation failed!\n");
         }
-
-        destroy_mst_result(result);
     }
 
+    destroy_mst_forest(forest);
     destroy_graph(graph);
 }
 
@@ -158,7 +162,7 @@ void compare_algorithms() {
     print_graph(graph);
 
     clock_t start, end;
-    double heap_time, simple_time;
+    double heap_time, simple_time, csr_time, kruskal_time;
 
     printf("Running Heap-based Prim's Algorithm:\n");
     start = clock();
@@ -172,6 +176,19 @@ void compare_algorithms() {
     end = clock();
     simple_time = ((double)(end - start)) / CLOCKS_PER_SEC;
 
+    printf("\nRunning CSR Prim's Algorithm:\n");
+    CSRGraph* csr = csr_from_graph(graph);
+    start = clock();
+    MST_Result* csr_result = prim_mst_csr(csr, 0);
+    end = clock();
+    csr_time = ((double)(end - start)) / CLOCKS_PER_SEC;
+
+    printf("\nRunning Kruskal's Algorithm:\n");
+    start = clock();
+    MST_Result* kruskal_result = kruskal_mst(csr, 0);
+    end = clock();
+    kruskal_time = ((double)(end - start)) / CLOCKS_PER_SEC;
+
     printf("\n=== Results Comparison ===\n");
 
     printf("\nHeap-based Algorithm:\n");
@@ -182,12 +199,26 @@ void compare_algorithms() {
     print_mst(simple_result);
     printf("Execution time: %.6f seconds\n", simple_time);
 
-    printf("\n=== Performance Analysis ===\n");
-    printf("Heap-based algorithm: O(E log V) - Better for dense graphs\n");
-    printf("Simple algorithm: O(V²) - Better for sparse graphs\n");
+    printf("\nCSR Algorithm:\n");
+    print_mst(csr_result);
+    printf("Execution time: %.6f seconds\n", csr_time);
 
-    if (heap_result->total_weight == simple_result->total_weight) {
-        printf("✓ Both algorithms found MST with same total weight: %d\n",
+    printf("\nKruskal Algorithm:\n");
+    print_mst(kruskal_result);
+    printf("Execution time: %.6f seconds\n", kruskal_time);
+
+    printf("\n=== Performance Analysis ===\n");
+    printf("Heap-based algorithm: O(E log V) - Better for sparse graphs\n");
+    printf("Simple algorithm: O(V²) - Better for dense graphs\n");
+    printf("CSR algorithm: O(E log V), O(V + E) memory\n");
+    printf("Kruskal algorithm: O(E log E) - Better for large sparse graphs\n");
+    printf("Auto selection for this graph: %s\n",
+           mst_engine_name(mst_select_engine(csr->vertices, csr->edges, csr->max_weight, 0, false)));
+
+    if (heap_result->total_weight == simple_result->total_weight &&
+        heap_result->total_weight == csr_result->total_weight &&
+        heap_result->total_weight == kruskal_result->total_weight) {
+        printf("✓ All algorithms found MST with same total weight: %lld\n",
                heap_result->total_weight);
     } else {
         printf("✗ Algorithms found different MST weights!\n");
@@ -195,10 +226,94 @@ void compare_algorithms() {
 
     destroy_mst_result(heap_result);
     destroy_mst_result(simple_result);
+    destroy_mst_result(csr_result);
+    destroy_mst_result(kruskal_result);
+    destroy_csr_graph(csr);
     destroy_graph(graph);
 }
 
-int main() {
+int run_graph_file(const char* path) {
+    GraphFileLayout layout = probe_graph_file(path);
+    MST_Result* result = NULL;
+    clock_t start, end;
+
+    if (layout == GRAPH_FILE_CSR) {
+        start = clock();
+        CSRGraph* graph = load_csr_graph_binary(path);
+        end = clock();
+        if (!graph) {
+            return EXIT_FAILURE;
+        }
+
+        printf("Loaded CSR graph: %d vertices, %d edges (%.6f seconds)\n",
+               graph->vertices, graph->edges, ((double)(end - start)) / CLOCKS_PER_SEC);
+
+        start = clock();
+        result = mst_auto(graph, 0, 0);
+        end = clock();
+        destroy_csr_graph(graph);
+    } else if (layout == GRAPH_FILE_DENSE) {
+        start = clock();
+        Graph* graph = load_graph_binary(path);
+        end = clock();
+        if (!graph) {
+            return EXIT_FAILURE;
+        }
+
+        printf("Loaded dense graph: %d vertices (%.6f seconds)\n",
+               graph->vertices, ((double)(end - start)) / CLOCKS_PER_SEC);
+
+        start = clock();
+        result = mst_auto_dense(graph, 0, 0);
+        end = clock();
+        destroy_graph(graph);
+    } else if (layout == GRAPH_FILE_EDGES) {
+        ExternalMSTStats stats;
+
+        start = clock();
+        result = external_mst(path, 0, NULL, &stats);
+        end = clock();
+        if (!result) {
+            return EXIT_FAILURE;
+        }
+
+        printf("Streamed edge file: %d vertices, %lld edges (%d runs, %d merge passes)\n",
+               result->vertex_count, (long long)stats.edges_read, stats.run_count,
+               stats.merge_passes);
+    } else {
+        start = clock();
+        CSRGraph* graph = load_edge_list(path, EDGE_FORMAT_AUTO, 0);
+        end = clock();
+        if (!graph) {
+            return EXIT_FAILURE;
+        }
+
+        printf("Parsed edge list: %d vertices, %d edges (%.6f seconds)\n",
+               graph->vertices, graph->edges, ((double)(end - start)) / CLOCKS_PER_SEC);
+
+        start = clock();
+        result = mst_auto(graph, 0, 0);
+        end = clock();
+        destroy_csr_graph(graph);
+    }
+
+    printf("Total weight of MST: %lld\n", result->total_weight);
+    printf("Number of edges: %d\n", result->vertex_count - 1);
+    printf("Execution time: %.6f seconds\n", ((double)(end - start)) / CLOCKS_PER_SEC);
+
+    if (instrument_enabled()) {
+        instrument_dump_json(stderr);
+    }
+
+    destroy_mst_result(result);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        return run_graph_file(argv[1]);
+    }
+
     printf("Prim's Minimum Spanning Tree Algorithm Implementation\n");
     printf("===================================================\n");
 
@@ -0,0 +1,193 @@
+#include "mst_batch.h"
+#include "mst_workspace.h"
+#include "thread_pool.h"
+
+typedef struct BatchDeque {
+    unsigned long long range;
+    char padding[CACHE_LINE_SIZE - sizeof(unsigned long long)];
+} BatchDeque;
+
+typedef struct BatchJob {
+    long long cost;
+    int index;
+} BatchJob;
+
+typedef struct BatchState {
+    Graph **graphs;
+    MST_Result *results;
+    int *components;
+    int *order;
+    BatchDeque *deques;
+    MSTWorkspace **workspaces;
+} BatchState;
+
+static unsigned long long pack_range(int begin, int end) {
+    return ((unsigned long long)(unsigned)begin << 32) | (unsigned)end;
+}
+
+static bool take_front(BatchDeque* deque, int* task) {
+    unsigned long long range = __atomic_load_n(&deque->range, __ATOMIC_ACQUIRE);
+
+    while (true) {
+        int begin = (int)(range >> 32);
+        int end = (int)(range & 0xFFFFFFFFULL);
+        if (begin >= end) {
+            return false;
+        }
+
+        if (__atomic_compare_exchange_n(&deque->range, &range, pack_range(begin + 1, end),
+                                        false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            *task = begin;
+            return true;
+        }
+    }
+}
+
+static bool take_back(BatchDeque* deque, int* task) {
+    unsigned long long range = __atomic_load_n(&deque->range, __ATOMIC_ACQUIRE);
+
+    while (true) {
+        int begin = (int)(range >> 32);
+        int end = (int)(range & 0xFFFFFFFFULL);
+        if (begin >= end) {
+            return false;
+        }
+
+        if (__atomic_compare_exchange_n(&deque->range, &range, pack_range(begin, end - 1),
+                                        false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            *task = end - 1;
+            return true;
+        }
+    }
+}
+
+static void batch_task(void* arg, int thread_id, int thread_count) {
+    BatchState* state = (BatchState*)arg;
+    MSTWorkspace* workspace = state->workspaces[thread_id];
+    int solved = 0;
+    int stolen = 0;
+
+    while (true) {
+        int task;
+        bool found = take_front(&state->deques[thread_id], &task);
+
+        for (int k = 1; !found && k < thread_count; k++) {
+            found = take_back(&state->deques[(thread_id + k) % thread_count], &task);
+            stolen += found;
+        }
+
+        if (!found) {
+            break;
+        }
+
+        int index = state->order[task];
+        int components = prim_msf_into(workspace, state->graphs[index], 0, &state->results[index]);
+        if (state->components) {
+            state->components[index] = components;
+        }
+        if (components > 1) {
+            debug_print("Batch graph %d is not connected: %d components", index, components);
+        }
+        solved++;
+    }
+
+    debug_print("Batch thread %d solved %d graphs (%d stolen)", thread_id, solved, stolen);
+}
+
+static int compare_jobs(const void* a, const void* b) {
+    const BatchJob* x = (const BatchJob*)a;
+    const BatchJob* y = (const BatchJob*)b;
+    if (x->cost != y->cost) {
+        return x->cost > y->cost ? -1 : 1;
+    }
+    return x->index - y->index;
+}
+
+MST_Result* prim_mst_batch(Graph** graphs, int count, int thread_count, int* components) {
+    if (!graphs || count <= 0) {
+        error_exit("Graph batch is empty");
+    }
+
+    long long total_vertices = 0;
+    for (int i = 0; i < count; i++) {
+        if (!graphs[i]) {
+            error_exit("Graph is NULL");
+        }
+        total_vertices += graphs[i]->vertices;
+    }
+
+    if (thread_count <= 0) {
+        thread_count = thread_pool_default_size();
+    }
+    if (thread_count > count) {
+        thread_count = count;
+    }
+
+    ThreadPool* pool = create_thread_pool(thread_count);
+
+    MST_Result* results = (MST_Result*)safe_malloc(count * sizeof(MST_Result));
+    int* buffers = (int*)safe_malloc(2 * total_vertices * sizeof(int));
+
+    BatchJob* jobs = (BatchJob*)safe_malloc(count * sizeof(BatchJob));
+    long long offset = 0;
+    for (int i = 0; i < count; i++) {
+        int vertices = graphs[i]->vertices;
+
+        results[i].parent = buffers + offset;
+        results[i].key = buffers + offset + vertices;
+        results[i].total_weight = 0;
+        results[i].vertex_count = vertices;
+        offset += 2 * (long long)vertices;
+
+        jobs[i].cost = (long long)vertices * vertices;
+        jobs[i].index = i;
+    }
+    qsort(jobs, count, sizeof(BatchJob), compare_jobs);
+
+    BatchState state;
+    state.graphs = graphs;
+    state.results = results;
+    state.components = components;
+    state.order = (int*)safe_malloc(count * sizeof(int));
+    state.deques = (BatchDeque*)safe_aligned_malloc(CACHE_LINE_SIZE,
+                                                    thread_count * sizeof(BatchDeque));
+    state.workspaces = (MSTWorkspace**)safe_malloc(thread_count * sizeof(MSTWorkspace*));
+
+    int next = 0;
+    for (int t = 0; t < thread_count; t++) {
+        int begin = next;
+        for (int j = t; j < count; j += thread_count) {
+            state.order[next++] = jobs[j].index;
+        }
+        state.deques[t].range = pack_range(begin, next);
+        state.workspaces[t] = create_mst_workspace(graphs[jobs[t].index]->vertices);
+    }
+
+    debug_print("Solving batch of %d graphs on %d threads", count, thread_count);
+    thread_pool_run(pool, batch_task, &state);
+
+    for (int t = 0; t < thread_count; t++) {
+        destroy_mst_workspace(state.workspaces[t]);
+    }
+
+    destroy_thread_pool(pool);
+    safe_free((void**)&state.workspaces);
+    safe_free((void**)&state.deques);
+    safe_free((void**)&state.order);
+    safe_free((void**)&jobs);
+
+    return results;
+}
+
+void destroy_mst_batch(MST_Result* results, int count) {
+    if (!results) {
+        return;
+    }
+
+    if (count > 0) {
+        safe_free((void**)&results[0].parent);
+    }
+
+    debug_print("Destroyed batch of %d MST results", count);
+    safe_free((void**)&results);
+}
\ No newline at end of file
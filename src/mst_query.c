@@ -0,0 +1,361 @@
+#include "mst_query.h"
+#include "thread_pool.h"
+
+typedef struct PathBatch {
+    MSTPathIndex *index;
+    const int *src;
+    const int *dest;
+    int *out;
+    int count;
+} PathBatch;
+
+static int* preorder_forest(MST_Result* result, int* offsets, int* children) {
+    int vertices = result->vertex_count;
+    int* order = (int*)safe_malloc(vertices * sizeof(int));
+    int* stack = (int*)safe_malloc(vertices * sizeof(int));
+    int count = 0;
+
+    for (int root = 0; root < vertices; root++) {
+        if (result->parent[root] != -1) {
+            continue;
+        }
+
+        int top = 0;
+        stack[top++] = root;
+        while (top > 0) {
+            int u = stack[--top];
+            order[count++] = u;
+            for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                stack[top++] = children[k];
+            }
+        }
+    }
+
+    safe_free((void**)&stack);
+
+    if (count != vertices) {
+        error_exit("MST parent array is not a forest");
+    }
+
+    return order;
+}
+
+static void build_children(MST_Result* result, int* offsets, int* children) {
+    int vertices = result->vertex_count;
+
+    for (int v = 0; v <= vertices; v++) {
+        offsets[v] = 0;
+    }
+    for (int v = 0; v < vertices; v++) {
+        int p = result->parent[v];
+        if (p < -1 || p >= vertices || p == v) {
+            error_exit("Invalid parent index");
+        }
+        if (p != -1) {
+            offsets[p + 1]++;
+        }
+    }
+    for (int v = 0; v < vertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    for (int v = 0; v < vertices; v++) {
+        if (result->parent[v] != -1) {
+            children[offsets[result->parent[v]]++] = v;
+        }
+    }
+    for (int v = vertices; v > 0; v--) {
+        offsets[v] = offsets[v - 1];
+    }
+    offsets[0] = 0;
+}
+
+static void build_block_table(MSTPathIndex* index) {
+    int vertices = index->vertex_count;
+    int blocks = index->block_count;
+
+    for (int p = 0; p < vertices; p++) {
+        bool first = (p & (PATH_BLOCK_SIZE - 1)) == 0;
+        index->block_prefix[p] = first || index->block_prefix[p - 1] < index->key[p] ?
+                                 index->key[p] : index->block_prefix[p - 1];
+    }
+    for (int p = vertices - 1; p >= 0; p--) {
+        bool last = p == vertices - 1 || ((p + 1) & (PATH_BLOCK_SIZE - 1)) == 0;
+        index->block_suffix[p] = last || index->block_suffix[p + 1] < index->key[p] ?
+                                 index->key[p] : index->block_suffix[p + 1];
+    }
+
+    int levels = 1;
+    while ((1 << levels) <= blocks) {
+        levels++;
+    }
+    index->level_count = levels;
+    index->block_table = (int*)safe_malloc(((size_t)levels * blocks + 1) * sizeof(int));
+
+    for (int b = 0; b < blocks; b++) {
+        index->block_table[b] = index->block_suffix[b << PATH_BLOCK_SHIFT];
+    }
+    for (int l = 1; l < levels; l++) {
+        int* prev = index->block_table + (size_t)(l - 1) * blocks;
+        int* row = index->block_table + (size_t)l * blocks;
+        int half = 1 << (l - 1);
+        for (int b = 0; b + (1 << l) <= blocks; b++) {
+            row[b] = prev[b] > prev[b + half] ? prev[b] : prev[b + half];
+        }
+    }
+}
+
+MSTPathIndex* create_mst_path_index(MST_Result* result) {
+    if (!result) {
+        error_exit("MST result is NULL");
+    }
+
+    int vertices = result->vertex_count;
+    int* offsets = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    int* children = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    build_children(result, offsets, children);
+
+    int* order = preorder_forest(result, offsets, children);
+    int* size = (int*)safe_malloc(vertices * sizeof(int));
+    int* heavy = (int*)safe_malloc(vertices * sizeof(int));
+    for (int v = 0; v < vertices; v++) {
+        size[v] = 1;
+        heavy[v] = -1;
+    }
+    for (int i = vertices - 1; i >= 0; i--) {
+        int v = order[i];
+        int p = result->parent[v];
+        if (p != -1) {
+            size[p] += size[v];
+            if (heavy[p] == -1 || size[v] > size[heavy[p]]) {
+                heavy[p] = v;
+            }
+        }
+    }
+
+    MSTPathIndex* index = (MSTPathIndex*)safe_malloc(sizeof(MSTPathIndex));
+    index->vertex_count = vertices;
+    index->block_count = (vertices + PATH_BLOCK_SIZE - 1) >> PATH_BLOCK_SHIFT;
+    index->position = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    index->vertex_at = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    index->nodes = (PathNode*)safe_malloc((vertices + 1) * sizeof(PathNode));
+    index->key = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    index->block_prefix = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    index->block_suffix = (int*)safe_malloc((vertices + 1) * sizeof(int));
+
+    int* head = size;
+    int* depth = (int*)safe_malloc(vertices * sizeof(int));
+    int* stack = order;
+    int next = 0;
+
+    for (int root = 0; root < vertices; root++) {
+        if (result->parent[root] != -1) {
+            continue;
+        }
+
+        int top = 0;
+        stack[top++] = root;
+        while (top > 0) {
+            int u = stack[--top];
+            int p = result->parent[u];
+            int position = next++;
+
+            index->position[u] = position;
+            index->vertex_at[position] = u;
+            depth[u] = p == -1 ? 0 : depth[p] + 1;
+            head[u] = p != -1 && heavy[p] == u ? head[p] : u;
+            index->key[position] = p == -1 ? -1 : result->key[u];
+
+            PathNode* node = &index->nodes[position];
+            int h = head[u];
+            node->head = index->position[h];
+            node->head_depth = depth[h];
+            node->jump = result->parent[h] == -1 ? -1 : index->position[result->parent[h]];
+            node->prefix_max = h == u || index->nodes[position - 1].prefix_max < index->key[position] ?
+                               index->key[position] : index->nodes[position - 1].prefix_max;
+
+            for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                if (children[k] != heavy[u]) {
+                    stack[top++] = children[k];
+                }
+            }
+            if (heavy[u] != -1) {
+                stack[top++] = heavy[u];
+            }
+        }
+    }
+
+    build_block_table(index);
+
+    safe_free((void**)&offsets);
+    safe_free((void**)&children);
+    safe_free((void**)&order);
+    safe_free((void**)&size);
+    safe_free((void**)&heavy);
+    safe_free((void**)&depth);
+
+    debug_print("Built path index over %d vertices with %d RMQ levels",
+               vertices, index->level_count);
+    return index;
+}
+
+static int range_max(const MSTPathIndex* index, int lo, int hi) {
+    int first = lo >> PATH_BLOCK_SHIFT;
+    int last = hi >> PATH_BLOCK_SHIFT;
+
+    if (first == last) {
+        int best = index->key[lo];
+        for (int p = lo + 1; p <= hi; p++) {
+            if (index->key[p] > best) {
+                best = index->key[p];
+            }
+        }
+        return best;
+    }
+
+    int best = index->block_suffix[lo] > index->block_prefix[hi] ?
+               index->block_suffix[lo] : index->block_prefix[hi];
+    int span = last - first - 1;
+    if (span > 0) {
+        int level = 31 - __builtin_clz((unsigned int)span);
+        const int* row = index->block_table + (size_t)level * index->block_count;
+        int left = row[first + 1];
+        int right = row[last - (1 << level)];
+        if (left > best) {
+            best = left;
+        }
+        if (right > best) {
+            best = right;
+        }
+    }
+    return best;
+}
+
+static int path_query(const MSTPathIndex* index, int a, int b, int* lca) {
+    const PathNode* nodes = index->nodes;
+    int best = -1;
+
+    while (nodes[a].head != nodes[b].head) {
+        if (nodes[a].head_depth < nodes[b].head_depth) {
+            int temp = a;
+            a = b;
+            b = temp;
+        }
+        if (nodes[a].jump == -1) {
+            *lca = -1;
+            return INF;
+        }
+        if (nodes[a].prefix_max > best) {
+            best = nodes[a].prefix_max;
+        }
+        a = nodes[a].jump;
+    }
+
+    if (a > b) {
+        int temp = a;
+        a = b;
+        b = temp;
+    }
+    *lca = a;
+
+    if (a < b) {
+        int segment = range_max(index, a + 1, b);
+        if (segment > best) {
+            best = segment;
+        }
+    }
+    return best;
+}
+
+static void check_vertex(const MSTPathIndex* index, int v) {
+    if ((unsigned int)v >= (unsigned int)index->vertex_count) {
+        error_exit("Invalid vertex");
+    }
+}
+
+int mst_path_lca(MSTPathIndex* index, int a, int b) {
+    if (!index) {
+        error_exit("Path index is NULL");
+    }
+    check_vertex(index, a);
+    check_vertex(index, b);
+
+    int lca;
+    path_query(index, index->position[a], index->position[b], &lca);
+    return lca == -1 ? -1 : index->vertex_at[lca];
+}
+
+int mst_path_max(MSTPathIndex* index, int a, int b) {
+    if (!index) {
+        error_exit("Path index is NULL");
+    }
+    check_vertex(index, a);
+    check_vertex(index, b);
+
+    int lca;
+    return path_query(index, index->position[a], index->position[b], &lca);
+}
+
+bool mst_path_improves(MSTPathIndex* index, int a, int b, int weight) {
+    return weight < mst_path_max(index, a, b);
+}
+
+static void run_batch_range(PathBatch* batch, int begin, int end) {
+    const MSTPathIndex* index = batch->index;
+    int lca;
+
+    for (int i = begin; i < end; i++) {
+        check_vertex(index, batch->src[i]);
+        check_vertex(index, batch->dest[i]);
+        batch->out[i] = path_query(index, index->position[batch->src[i]],
+                                   index->position[batch->dest[i]], &lca);
+    }
+}
+
+static void path_batch_task(void* arg, int thread_id, int thread_count) {
+    PathBatch* batch = (PathBatch*)arg;
+    int begin, end;
+    thread_chunk(batch->count, thread_id, thread_count, &begin, &end);
+    run_batch_range(batch, begin, end);
+}
+
+void mst_path_max_batch(MSTPathIndex* index, const int* src, const int* dest, int count,
+                        int* out, int thread_count) {
+    if (!index || !src || !dest || !out) {
+        error_exit("Path batch argument is NULL");
+    }
+
+    PathBatch batch;
+    batch.index = index;
+    batch.src = src;
+    batch.dest = dest;
+    batch.out = out;
+    batch.count = count;
+
+    if (thread_count <= 0) {
+        thread_count = thread_pool_default_size();
+    }
+
+    if (thread_count == 1 || count < PATH_BATCH_PARALLEL_MIN) {
+        run_batch_range(&batch, 0, count);
+        return;
+    }
+
+    ThreadPool* pool = create_thread_pool(thread_count);
+    thread_pool_run(pool, path_batch_task, &batch);
+    destroy_thread_pool(pool);
+}
+
+void destroy_mst_path_index(MSTPathIndex* index) {
+    if (!index) {
+        return;
+    }
+
+    safe_free((void**)&index->position);
+    safe_free((void**)&index->vertex_at);
+    safe_free((void**)&index->nodes);
+    safe_free((void**)&index->key);
+    safe_free((void**)&index->block_prefix);
+    safe_free((void**)&index->block_suffix);
+    safe_free((void**)&index->block_table);
+    safe_free((void**)&index);
+}
\ No newline at end of file
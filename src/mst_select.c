@@ -0,0 +1,136 @@
+#include "mst_select.h"
+#include "prim_dense.h"
+#include "kruskal.h"
+#include "boruvka.h"
+#include "thread_pool.h"
+
+MSTEngine mst_select_engine(int vertices, long long edges, int max_weight, int thread_count,
+                            bool dense_input) {
+    if (thread_count <= 0) {
+        thread_count = thread_pool_default_size();
+    }
+
+    bool parallel_dense = thread_count > 1 && vertices >= MST_DENSE_PARALLEL_MIN_VERTICES;
+    if (dense_input) {
+        return parallel_dense ? MST_ENGINE_DENSE_PARALLEL_PRIM : MST_ENGINE_DENSE_PRIM;
+    }
+
+    if (vertices <= 1 || edges <= 0) {
+        return MST_ENGINE_HEAP_PRIM;
+    }
+
+    if (parallel_dense && edges * MST_DENSE_EDGE_FACTOR >= (long long)vertices * vertices) {
+        return MST_ENGINE_DENSE_PARALLEL_PRIM;
+    }
+
+    long long degree = 2 * edges / vertices;
+    bool wide_range = max_weight < 0 || (long long)max_weight > edges;
+
+    if (thread_count >= MST_BORUVKA_MIN_THREADS && edges >= MST_BORUVKA_MIN_EDGES) {
+        return MST_ENGINE_BORUVKA;
+    }
+
+    if (degree <= MST_KRUSKAL_MAX_DEGREE && (wide_range || vertices >= MST_LARGE_GRAPH_VERTICES)) {
+        return MST_ENGINE_KRUSKAL;
+    }
+
+    if (degree <= MST_FILTER_KRUSKAL_MAX_DEGREE && vertices >= 4 * MST_LARGE_GRAPH_VERTICES) {
+        return MST_ENGINE_FILTER_KRUSKAL;
+    }
+
+    return wide_range ? MST_ENGINE_HEAP_PRIM : MST_ENGINE_BUCKET_PRIM;
+}
+
+MST_Result* mst_run_engine(CSRGraph* graph, int start_vertex, MSTEngine engine, int thread_count) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    switch (engine) {
+        case MST_ENGINE_DENSE_PRIM:
+            return prim_mst_dense_csr(graph, start_vertex);
+        case MST_ENGINE_DENSE_PARALLEL_PRIM:
+            return prim_mst_dense_parallel_csr(graph, start_vertex, thread_count);
+        case MST_ENGINE_HEAP_PRIM:
+            return prim_mst_csr_with_pq(graph, start_vertex, PQ_DEFAULT_BACKEND);
+        case MST_ENGINE_BUCKET_PRIM:
+            return prim_mst_csr_with_pq(graph, start_vertex, PQ_BUCKET_QUEUE);
+        case MST_ENGINE_KRUSKAL:
+            return kruskal_mst(graph, start_vertex);
+        case MST_ENGINE_FILTER_KRUSKAL:
+            return filter_kruskal_mst(graph, start_vertex);
+        case MST_ENGINE_BORUVKA:
+            return boruvka_mst(graph, start_vertex, thread_count);
+        default:
+            error_exit("Unknown MST engine");
+    }
+
+    return NULL;
+}
+
+MST_Result* mst_auto(CSRGraph* graph, int start_vertex, int thread_count) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    MSTEngine engine = mst_select_engine(graph->vertices, graph->edges, graph->max_weight,
+                                         thread_count, false);
+    debug_print("Selected %s engine for %d vertices and %d edges",
+               mst_engine_name(engine), graph->vertices, graph->edges);
+    return mst_run_engine(graph, start_vertex, engine, thread_count);
+}
+
+MST_Result* mst_run_engine_dense(Graph* graph, int start_vertex, MSTEngine engine, int thread_count) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    switch (engine) {
+        case MST_ENGINE_DENSE_PRIM:
+            return prim_mst_dense(graph, start_vertex);
+        case MST_ENGINE_DENSE_PARALLEL_PRIM:
+            return prim_mst_dense_parallel(graph, start_vertex, thread_count);
+        case MST_ENGINE_HEAP_PRIM:
+            return prim_mst(graph, start_vertex);
+        default: {
+            CSRGraph* csr = csr_from_graph(graph);
+            MST_Result* result = mst_run_engine(csr, start_vertex, engine, thread_count);
+            destroy_csr_graph(csr);
+            return result;
+        }
+    }
+}
+
+MST_Result* mst_auto_dense(Graph* graph, int start_vertex, int thread_count) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    long long edges = (long long)graph->vertices * (graph->vertices - 1) / 2;
+    MSTEngine engine = mst_select_engine(graph->vertices, edges, graph->max_weight,
+                                         thread_count, true);
+    debug_print("Selected %s engine for a %d-vertex matrix",
+               mst_engine_name(engine), graph->vertices);
+    return mst_run_engine_dense(graph, start_vertex, engine, thread_count);
+}
+
+const char* mst_engine_name(MSTEngine engine) {
+    switch (engine) {
+        case MST_ENGINE_DENSE_PRIM:
+            return "dense-prim";
+        case MST_ENGINE_DENSE_PARALLEL_PRIM:
+            return "dense-parallel-prim";
+        case MST_ENGINE_HEAP_PRIM:
+            return "heap-prim";
+        case MST_ENGINE_BUCKET_PRIM:
+            return "bucket-prim";
+        case MST_ENGINE_KRUSKAL:
+            return "kruskal";
+        case MST_ENGINE_FILTER_KRUSKAL:
+            return "filter-kruskal";
+        case MST_ENGINE_BORUVKA:
+            return "boruvka";
+        default:
+            return "unknown";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,279 @@
+#include "mst_verify.h"
+#include "instrument.h"
+
+typedef struct VerifyState {
+    int *up;
+    int *path_max;
+    int *path;
+    int *head;
+    int *next;
+    int *query_src;
+} VerifyState;
+
+static int find_with_max(VerifyState* state, int x, int* max_weight) {
+    int* up = state->up;
+    int* path_max = state->path_max;
+    int length = 0;
+
+    while (up[x] != x) {
+        state->path[length++] = x;
+        x = up[x];
+    }
+
+    for (int i = length - 2; i >= 0; i--) {
+        int node = state->path[i];
+        int above = up[node];
+        if (path_max[above] > path_max[node]) {
+            path_max[node] = path_max[above];
+        }
+        up[node] = x;
+    }
+
+    *max_weight = length > 0 ? path_max[state->path[0]] : -1;
+    return x;
+}
+
+static int* preorder_from_parents(MST_Result* result, int* visited) {
+    int vertices = result->vertex_count;
+    int* offsets = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    int* children = (int*)safe_malloc(vertices * sizeof(int));
+    int* order = (int*)safe_malloc(vertices * sizeof(int));
+    int root = -1;
+
+    for (int v = 0; v <= vertices; v++) {
+        offsets[v] = 0;
+    }
+    for (int v = 0; v < vertices; v++) {
+        if (result->parent[v] == -1) {
+            root = v;
+        } else {
+            offsets[result->parent[v] + 1]++;
+        }
+    }
+    for (int v = 0; v < vertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    for (int v = 0; v < vertices; v++) {
+        if (result->parent[v] != -1) {
+            children[offsets[result->parent[v]]++] = v;
+        }
+    }
+    for (int v = vertices; v > 0; v--) {
+        offsets[v] = offsets[v - 1];
+    }
+    offsets[0] = 0;
+
+    int* stack = (int*)safe_malloc(vertices * sizeof(int));
+    int top = 0;
+    int count = 0;
+
+    if (root >= 0) {
+        stack[top++] = root;
+    }
+    while (top > 0) {
+        int u = stack[--top];
+        order[count++] = u;
+        for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+            stack[top++] = children[k];
+        }
+    }
+
+    safe_free((void**)&stack);
+    safe_free((void**)&offsets);
+    safe_free((void**)&children);
+
+    *visited = count;
+    return order;
+}
+
+static bool is_tree_edge(MST_Result* result, int u, int v, int weight) {
+    return (result->parent[u] == v && result->key[u] == weight) ||
+           (result->parent[v] == u && result->key[v] == weight);
+}
+
+static int collect_candidates(CSRGraph* graph, MST_Result* result, const int* rank,
+                              const int* root_max, int** out_src, int** out_dest, int** out_weight) {
+    int capacity = 1024;
+    int count = 0;
+    int* src = (int*)safe_malloc(capacity * sizeof(int));
+    int* dest = (int*)safe_malloc(capacity * sizeof(int));
+    int* weight = (int*)safe_malloc(capacity * sizeof(int));
+
+    for (int u = 0; u < graph->vertices; u++) {
+        for (int k = graph->offsets[u]; k < graph->offsets[u + 1]; k++) {
+            int v = graph->neighbors[k];
+            int w = graph->weights[k];
+            INSTR_COUNT(INSTR_RELAX_SCANNED);
+            if (v <= u || (w >= root_max[u] && w >= root_max[v]) || is_tree_edge(result, u, v, w)) {
+                continue;
+            }
+
+            if (count == capacity) {
+                capacity *= 2;
+                src = (int*)safe_realloc(src, capacity * sizeof(int));
+                dest = (int*)safe_realloc(dest, capacity * sizeof(int));
+                weight = (int*)safe_realloc(weight, capacity * sizeof(int));
+            }
+
+            int ru = rank[u];
+            int rv = rank[v];
+            src[count] = ru < rv ? ru : rv;
+            dest[count] = ru < rv ? rv : ru;
+            weight[count] = w;
+            count++;
+        }
+    }
+
+    *out_src = src;
+    *out_dest = dest;
+    *out_weight = weight;
+    return count;
+}
+
+static bool check_cycle_property(CSRGraph* graph, MST_Result* result) {
+    int vertices = graph->vertices;
+    int visited;
+    int* order = preorder_from_parents(result, &visited);
+
+    if (visited != vertices) {
+        debug_print("Parent array reaches %d of %d vertices", visited, vertices);
+        safe_free((void**)&order);
+        return false;
+    }
+
+    int* rank = (int*)safe_malloc(vertices * sizeof(int));
+    int* root_max = (int*)safe_malloc(vertices * sizeof(int));
+    int* parent_rank = (int*)safe_malloc(vertices * sizeof(int));
+    int* parent_key = (int*)safe_malloc(vertices * sizeof(int));
+    for (int i = 0; i < vertices; i++) {
+        int v = order[i];
+        int p = result->parent[v];
+        rank[v] = i;
+        parent_rank[i] = p == -1 ? -1 : rank[p];
+        parent_key[i] = result->key[v];
+        root_max[v] = p == -1 ? -1 : (root_max[p] > result->key[v] ? root_max[p] : result->key[v]);
+    }
+
+    int* cand_src;
+    int* cand_dest;
+    int* cand_weight;
+    int count = collect_candidates(graph, result, rank, root_max, &cand_src, &cand_dest, &cand_weight);
+
+    int* offsets = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    int* dest = (int*)safe_malloc((count + 1) * sizeof(int));
+    int* weight = (int*)safe_malloc((count + 1) * sizeof(int));
+    for (int v = 0; v <= vertices; v++) {
+        offsets[v] = 0;
+    }
+    for (int c = 0; c < count; c++) {
+        offsets[cand_src[c] + 1]++;
+    }
+    for (int v = 0; v < vertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    for (int c = 0; c < count; c++) {
+        int slot = offsets[cand_src[c]]++;
+        dest[slot] = cand_dest[c];
+        weight[slot] = cand_weight[c];
+    }
+    for (int v = vertices; v > 0; v--) {
+        offsets[v] = offsets[v - 1];
+    }
+    offsets[0] = 0;
+
+    safe_free((void**)&cand_src);
+    safe_free((void**)&cand_dest);
+    safe_free((void**)&cand_weight);
+
+    VerifyState state;
+    state.up = (int*)safe_malloc(vertices * sizeof(int));
+    state.path_max = (int*)safe_malloc(vertices * sizeof(int));
+    state.path = (int*)safe_malloc(vertices * sizeof(int));
+    state.head = (int*)safe_malloc(vertices * sizeof(int));
+    state.next = (int*)safe_malloc((count + 1) * sizeof(int));
+    state.query_src = (int*)safe_malloc((count + 1) * sizeof(int));
+    for (int v = 0; v < vertices; v++) {
+        state.up[v] = v;
+        state.path_max[v] = -1;
+        state.head[v] = -1;
+    }
+
+    bool optimal = true;
+
+    for (int x = vertices - 1; x >= 0 && optimal; x--) {
+        for (int c = offsets[x]; c < offsets[x + 1]; c++) {
+            int max_weight;
+            int lca = find_with_max(&state, dest[c], &max_weight);
+            if (lca != x) {
+                state.query_src[c] = x;
+                state.next[c] = state.head[lca];
+                state.head[lca] = c;
+            } else if (weight[c] < max_weight) {
+                debug_print("Edge %d -- %d with weight %d beats tree path maximum %d",
+                           order[x], order[dest[c]], weight[c], max_weight);
+                optimal = false;
+                break;
+            }
+        }
+
+        for (int c = state.head[x]; c != -1 && optimal; c = state.next[c]) {
+            int src_max;
+            int dest_max;
+            find_with_max(&state, state.query_src[c], &src_max);
+            find_with_max(&state, dest[c], &dest_max);
+
+            int max_weight = src_max > dest_max ? src_max : dest_max;
+            if (weight[c] < max_weight) {
+                debug_print("Edge %d -- %d with weight %d beats tree path maximum %d",
+                           order[state.query_src[c]], order[dest[c]], weight[c], max_weight);
+                optimal = false;
+            }
+        }
+
+        if (parent_rank[x] != -1) {
+            state.up[x] = parent_rank[x];
+            state.path_max[x] = parent_key[x];
+        }
+    }
+
+    safe_free((void**)&state.up);
+    safe_free((void**)&state.path_max);
+    safe_free((void**)&state.path);
+    safe_free((void**)&state.head);
+    safe_free((void**)&state.next);
+    safe_free((void**)&state.query_src);
+    safe_free((void**)&offsets);
+    safe_free((void**)&dest);
+    safe_free((void**)&weight);
+    safe_free((void**)&rank);
+    safe_free((void**)&root_max);
+    safe_free((void**)&parent_rank);
+    safe_free((void**)&parent_key);
+    safe_free((void**)&order);
+
+    return optimal;
+}
+
+bool verify_mst_csr(CSRGraph* graph, MST_Result* result) {
+    if (!validate_mst_csr(graph, result)) {
+        return false;
+    }
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SOLVE);
+    bool optimal = check_cycle_property(graph, result);
+    INSTR_PHASE_END(INSTR_PHASE_SOLVE);
+
+    return optimal;
+}
+
+bool verify_mst(Graph* graph, MST_Result* result) {
+    if (!validate_mst(graph, result)) {
+        return false;
+    }
+
+    CSRGraph* csr = csr_from_graph(graph);
+    bool optimal = check_cycle_property(csr, result);
+    destroy_csr_graph(csr);
+
+    return optimal;
+}
\ No newline at end of file
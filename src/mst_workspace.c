@@ -0,0 +1,91 @@
+#include "mst_workspace.h"
+
+#define WORKSPACE_QUEUES (PQ_BUCKET_QUEUE + 1)
+
+struct MSTWorkspace {
+    Arena *arena;
+    PriorityQueue *queues[WORKSPACE_QUEUES];
+};
+
+MSTWorkspace* create_mst_workspace(int vertices) {
+    if (vertices < 0) {
+        error_exit("Number of vertices cannot be negative");
+    }
+
+    MSTWorkspace* workspace = (MSTWorkspace*)safe_malloc(sizeof(MSTWorkspace));
+
+    workspace->arena = create_arena((size_t)vertices * sizeof(int) * 4);
+    for (int i = 0; i < WORKSPACE_QUEUES; i++) {
+        workspace->queues[i] = NULL;
+    }
+
+    debug_print("Created MST workspace for %d vertices", vertices);
+    return workspace;
+}
+
+Arena* mst_workspace_arena(MSTWorkspace* workspace) {
+    if (!workspace) {
+        error_exit("Workspace is NULL");
+    }
+
+    return workspace->arena;
+}
+
+PriorityQueue* mst_workspace_queue(MSTWorkspace* workspace, int vertices,
+                                   PQBackend backend, int max_key) {
+    if (!workspace) {
+        error_exit("Workspace is NULL");
+    }
+
+    if ((int)backend < 0 || (int)backend >= WORKSPACE_QUEUES) {
+        error_exit("Unknown priority queue backend");
+    }
+
+    PriorityQueue* pq = workspace->queues[backend];
+
+    if (pq && pq->size != 0) {
+        error_exit("Workspace priority queue is still in use");
+    }
+
+    if (pq && pq->capacity >= vertices &&
+        (backend != PQ_BUCKET_QUEUE || pq->max_key >= max_key)) {
+        return pq;
+    }
+
+    if (pq) {
+        if (pq->capacity > vertices) {
+            vertices = pq->capacity;
+        }
+        if (pq->max_key > max_key) {
+            max_key = pq->max_key;
+        }
+        destroy_pq(pq);
+    }
+
+    pq = create_pq_bounded(vertices, backend, max_key);
+    workspace->queues[backend] = pq;
+
+    debug_print("Workspace %s queue grown to %d vertices", pq_backend_name(backend), vertices);
+    return pq;
+}
+
+void mst_workspace_reset(MSTWorkspace* workspace) {
+    if (!workspace) {
+        error_exit("Workspace is NULL");
+    }
+
+    arena_reset(workspace->arena);
+}
+
+void destroy_mst_workspace(MSTWorkspace* workspace) {
+    if (!workspace) {
+        return;
+    }
+
+    for (int i = 0; i < WORKSPACE_QUEUES; i++) {
+        destroy_pq(workspace->queues[i]);
+    }
+
+    destroy_arena(workspace->arena);
+    safe_free((void**)&workspace);
+}
\ No newline at end of file
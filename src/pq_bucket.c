@@ -0,0 +1,141 @@
+#include "pq_backend.h"
+
+#define BUCKET_WORD_BITS 64
+
+typedef struct BucketQueue {
+    int *head;
+    int *next;
+    int *prev;
+    unsigned long long *bits;
+    unsigned long long *summary;
+    int bucket_count;
+    int word_count;
+    int summary_count;
+} BucketQueue;
+
+static int bucket_of(PriorityQueue* pq, int key) {
+    return key == INF ? pq->max_key + 1 : key;
+}
+
+static void bucket_add(BucketQueue* queue, int vertex, int bucket) {
+    queue->prev[vertex] = -1;
+    queue->next[vertex] = queue->head[bucket];
+    if (queue->head[bucket] != -1) {
+        queue->prev[queue->head[bucket]] = vertex;
+    }
+    queue->head[bucket] = vertex;
+
+    int word = bucket / BUCKET_WORD_BITS;
+    queue->bits[word] |= 1ULL << (bucket % BUCKET_WORD_BITS);
+    queue->summary[word / BUCKET_WORD_BITS] |= 1ULL << (word % BUCKET_WORD_BITS);
+}
+
+static void bucket_remove(BucketQueue* queue, int vertex, int bucket) {
+    if (queue->prev[vertex] != -1) {
+        queue->next[queue->prev[vertex]] = queue->next[vertex];
+    } else {
+        queue->head[bucket] = queue->next[vertex];
+    }
+    if (queue->next[vertex] != -1) {
+        queue->prev[queue->next[vertex]] = queue->prev[vertex];
+    }
+
+    if (queue->head[bucket] == -1) {
+        int word = bucket / BUCKET_WORD_BITS;
+        queue->bits[word] &= ~(1ULL << (bucket % BUCKET_WORD_BITS));
+        if (queue->bits[word] == 0) {
+            queue->summary[word / BUCKET_WORD_BITS] &= ~(1ULL << (word % BUCKET_WORD_BITS));
+        }
+    }
+}
+
+static int bucket_find_min(BucketQueue* queue) {
+    for (int s = 0; s < queue->summary_count; s++) {
+        if (queue->summary[s]) {
+            int word = s * BUCKET_WORD_BITS + __builtin_ctzll(queue->summary[s]);
+            return word * BUCKET_WORD_BITS + __builtin_ctzll(queue->bits[word]);
+        }
+    }
+    return -1;
+}
+
+static void bucket_init(PriorityQueue* pq) {
+    BucketQueue* queue = (BucketQueue*)safe_malloc(sizeof(BucketQueue));
+
+    queue->bucket_count = pq->max_key + 2;
+    queue->word_count = (queue->bucket_count + BUCKET_WORD_BITS - 1) / BUCKET_WORD_BITS;
+    queue->summary_count = (queue->word_count + BUCKET_WORD_BITS - 1) / BUCKET_WORD_BITS;
+
+    queue->head = (int*)safe_malloc(queue->bucket_count * sizeof(int));
+    queue->next = (int*)safe_malloc(pq->capacity * sizeof(int));
+    queue->prev = (int*)safe_malloc(pq->capacity * sizeof(int));
+    queue->bits = (unsigned long long*)safe_malloc(queue->word_count * sizeof(unsigned long long));
+    queue->summary = (unsigned long long*)safe_malloc(queue->summary_count * sizeof(unsigned long long));
+
+    for (int b = 0; b < queue->bucket_count; b++) {
+        queue->head[b] = -1;
+    }
+    for (int w = 0; w < queue->word_count; w++) {
+        queue->bits[w] = 0;
+    }
+    for (int s = 0; s < queue->summary_count; s++) {
+        queue->summary[s] = 0;
+    }
+
+    pq->impl = queue;
+}
+
+static void bucket_insert(PriorityQueue* pq, int vertex, int key) {
+    BucketQueue* queue = (BucketQueue*)pq->impl;
+    int bucket = bucket_of(pq, key);
+
+    pq->key[vertex] = key;
+    pq->pos[vertex] = bucket;
+    pq->size++;
+
+    bucket_add(queue, vertex, bucket);
+}
+
+static int bucket_extract_min(PriorityQueue* pq) {
+    BucketQueue* queue = (BucketQueue*)pq->impl;
+    int bucket = bucket_find_min(queue);
+    int min_vertex = queue->head[bucket];
+
+    bucket_remove(queue, min_vertex, bucket);
+    pq->pos[min_vertex] = -1;
+    pq->size--;
+
+    return min_vertex;
+}
+
+static void bucket_decrease_key(PriorityQueue* pq, int vertex, int new_key) {
+    BucketQueue* queue = (BucketQueue*)pq->impl;
+    int bucket = bucket_of(pq, new_key);
+
+    bucket_remove(queue, vertex, pq->pos[vertex]);
+    pq->key[vertex] = new_key;
+    pq->pos[vertex] = bucket;
+    bucket_add(queue, vertex, bucket);
+}
+
+static void bucket_release(PriorityQueue* pq) {
+    BucketQueue* queue = (BucketQueue*)pq->impl;
+    if (!queue) {
+        return;
+    }
+
+    safe_free((void**)&queue->head);
+    safe_free((void**)&queue->next);
+    safe_free((void**)&queue->prev);
+    safe_free((void**)&queue->bits);
+    safe_free((void**)&queue->summary);
+    safe_free((void**)&pq->impl);
+}
+
+const PQOps pq_bucket_ops = {
+    bucket_init,
+    bucket_insert,
+    bucket_extract_min,
+    bucket_decrease_key,
+    bucket_release
+};
\ No newline at end of file
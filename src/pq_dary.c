@@ -0,0 +1,148 @@
+#include "pq_backend.h"
+
+typedef struct DaryEntry {
+    int key;
+    int vertex;
+} DaryEntry;
+
+typedef struct DaryHeap {
+    DaryEntry *block;
+    DaryEntry *entries;
+    int arity;
+} DaryHeap;
+
+static void dary_sift_up(PriorityQueue* pq, DaryHeap* heap, int idx) {
+    DaryEntry moving = heap->entries[idx];
+
+    while (idx > 0) {
+        int parent = (idx - 1) / heap->arity;
+        INSTR_COUNT(INSTR_COMPARISONS);
+        if (moving.key >= heap->entries[parent].key) {
+            break;
+        }
+        heap->entries[idx] = heap->entries[parent];
+        INSTR_COUNT(INSTR_HEAP_SIFTS);
+        pq->pos[heap->entries[idx].vertex] = idx;
+        idx = parent;
+    }
+
+    heap->entries[idx] = moving;
+    pq->pos[moving.vertex] = idx;
+}
+
+static void dary_sift_down(PriorityQueue* pq, DaryHeap* heap, int idx) {
+    DaryEntry moving = heap->entries[idx];
+
+    while (true) {
+        int first = heap->arity * idx + 1;
+        if (first >= pq->size) {
+            break;
+        }
+
+        int last = first + heap->arity;
+        if (last > pq->size) {
+            last = pq->size;
+        }
+
+        int smallest = first;
+        for (int child = first + 1; child < last; child++) {
+            if (heap->entries[child].key < heap->entries[smallest].key) {
+                smallest = child;
+            }
+        }
+
+        INSTR_ADD(INSTR_COMPARISONS, last - first);
+        if (heap->entries[smallest].key >= moving.key) {
+            break;
+        }
+
+        heap->entries[idx] = heap->entries[smallest];
+        INSTR_COUNT(INSTR_HEAP_SIFTS);
+        pq->pos[heap->entries[idx].vertex] = idx;
+        idx = smallest;
+    }
+
+    heap->entries[idx] = moving;
+    pq->pos[moving.vertex] = idx;
+}
+
+static void dary_init(PriorityQueue* pq, int arity) {
+    DaryHeap* heap = (DaryHeap*)safe_malloc(sizeof(DaryHeap));
+    heap->arity = arity;
+
+    size_t slots = (size_t)pq->capacity + arity - 1;
+    size_t bytes = (slots * sizeof(DaryEntry) + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+    heap->block = (DaryEntry*)safe_aligned_malloc(CACHE_LINE_SIZE, bytes);
+    heap->entries = heap->block + arity - 1;
+
+    pq->impl = heap;
+}
+
+static void dary4_init(PriorityQueue* pq) {
+    dary_init(pq, 4);
+}
+
+static void dary8_init(PriorityQueue* pq) {
+    dary_init(pq, 8);
+}
+
+static void dary_insert(PriorityQueue* pq, int vertex, int key) {
+    DaryHeap* heap = (DaryHeap*)pq->impl;
+
+    pq->key[vertex] = key;
+    heap->entries[pq->size].key = key;
+    heap->entries[pq->size].vertex = vertex;
+    pq->size++;
+
+    dary_sift_up(pq, heap, pq->size - 1);
+}
+
+static int dary_extract_min(PriorityQueue* pq) {
+    DaryHeap* heap = (DaryHeap*)pq->impl;
+    int min_vertex = heap->entries[0].vertex;
+
+    pq->size--;
+    pq->pos[min_vertex] = -1;
+
+    if (pq->size > 0) {
+        heap->entries[0] = heap->entries[pq->size];
+        dary_sift_down(pq, heap, 0);
+    }
+
+    return min_vertex;
+}
+
+static void dary_decrease_key(PriorityQueue* pq, int vertex, int new_key) {
+    DaryHeap* heap = (DaryHeap*)pq->impl;
+    int idx = pq->pos[vertex];
+
+    pq->key[vertex] = new_key;
+    heap->entries[idx].key = new_key;
+    dary_sift_up(pq, heap, idx);
+}
+
+static void dary_release(PriorityQueue* pq) {
+    DaryHeap* heap = (DaryHeap*)pq->impl;
+    if (!heap) {
+        return;
+    }
+
+    safe_free((void**)&heap->block);
+    safe_free((void**)&pq->impl);
+}
+
+const PQOps pq_dary4_ops = {
+    dary4_init,
+    dary_insert,
+    dary_extract_min,
+    dary_decrease_key,
+    dary_release
+};
+
+const PQOps pq_dary8_ops = {
+    dary8_init,
+    dary_insert,
+    dary_extract_min,
+    dary_decrease_key,
+    dary_release
+};
\ No newline at end of file
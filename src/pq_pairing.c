@@ -0,0 +1,137 @@
+#include "pq_backend.h"
+
+typedef struct PairingHeap {
+    int *child;
+    int *sibling;
+    int *prev;
+    int root;
+} PairingHeap;
+
+static int pairing_link(PriorityQueue* pq, PairingHeap* heap, int a, int b) {
+    INSTR_COUNT(INSTR_COMPARISONS);
+    INSTR_COUNT(INSTR_HEAP_SIFTS);
+    if (pq->key[b] < pq->key[a]) {
+        int temp = a;
+        a = b;
+        b = temp;
+    }
+
+    heap->sibling[b] = heap->child[a];
+    if (heap->child[a] != -1) {
+        heap->prev[heap->child[a]] = b;
+    }
+    heap->prev[b] = a;
+    heap->child[a] = b;
+
+    return a;
+}
+
+static void pairing_init(PriorityQueue* pq) {
+    PairingHeap* heap = (PairingHeap*)safe_malloc(sizeof(PairingHeap));
+
+    heap->child = (int*)safe_malloc(pq->capacity * sizeof(int));
+    heap->sibling = (int*)safe_malloc(pq->capacity * sizeof(int));
+    heap->prev = (int*)safe_malloc(pq->capacity * sizeof(int));
+    heap->root = -1;
+
+    pq->impl = heap;
+}
+
+static void pairing_insert(PriorityQueue* pq, int vertex, int key) {
+    PairingHeap* heap = (PairingHeap*)pq->impl;
+
+    pq->key[vertex] = key;
+    pq->pos[vertex] = 0;
+    heap->child[vertex] = -1;
+    heap->sibling[vertex] = -1;
+    heap->prev[vertex] = -1;
+    pq->size++;
+
+    heap->root = (heap->root == -1) ? vertex : pairing_link(pq, heap, heap->root, vertex);
+}
+
+static int pairing_extract_min(PriorityQueue* pq) {
+    PairingHeap* heap = (PairingHeap*)pq->impl;
+    int min_vertex = heap->root;
+
+    int pairs = -1;
+    int current = heap->child[min_vertex];
+    while (current != -1) {
+        int partner = heap->sibling[current];
+        int next = -1;
+        int merged = current;
+
+        heap->prev[current] = -1;
+        heap->sibling[current] = -1;
+
+        if (partner != -1) {
+            next = heap->sibling[partner];
+            heap->prev[partner] = -1;
+            heap->sibling[partner] = -1;
+            merged = pairing_link(pq, heap, current, partner);
+        }
+
+        heap->sibling[merged] = pairs;
+        pairs = merged;
+        current = next;
+    }
+
+    int root = -1;
+    while (pairs != -1) {
+        int next = heap->sibling[pairs];
+        heap->sibling[pairs] = -1;
+        root = (root == -1) ? pairs : pairing_link(pq, heap, root, pairs);
+        pairs = next;
+    }
+
+    heap->root = root;
+    pq->pos[min_vertex] = -1;
+    pq->size--;
+
+    return min_vertex;
+}
+
+static void pairing_decrease_key(PriorityQueue* pq, int vertex, int new_key) {
+    PairingHeap* heap = (PairingHeap*)pq->impl;
+
+    pq->key[vertex] = new_key;
+    if (vertex == heap->root) {
+        return;
+    }
+
+    int prev = heap->prev[vertex];
+    int next = heap->sibling[vertex];
+
+    if (heap->child[prev] == vertex) {
+        heap->child[prev] = next;
+    } else {
+        heap->sibling[prev] = next;
+    }
+    if (next != -1) {
+        heap->prev[next] = prev;
+    }
+
+    heap->prev[vertex] = -1;
+    heap->sibling[vertex] = -1;
+    heap->root = pairing_link(pq, heap, heap->root, vertex);
+}
+
+static void pairing_release(PriorityQueue* pq) {
+    PairingHeap* heap = (PairingHeap*)pq->impl;
+    if (!heap) {
+        return;
+    }
+
+    safe_free((void**)&heap->child);
+    safe_free((void**)&heap->sibling);
+    safe_free((void**)&heap->prev);
+    safe_free((void**)&pq->impl);
+}
+
+const PQOps pq_pairing_ops = {
+    pairing_init,
+    pairing_insert,
+    pairing_extract_min,
+    pairing_decrease_key,
+    pairing_release
+};
\ No newline at end of file
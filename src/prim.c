@@ -1,4 +1,6 @@
 #include "prim.h"
+#include "pq_backend.h"
+#include "mst_workspace.h"
 
 MST_Result* create_mst_result(int vertices) {
     MST_Result* result = (MST_Result*)safe_malloc(sizeof(MST_Result));
@@ -16,70 +18,229 @@ MST_Result* create_mst_result(int vertices) {
     return result;
 }
 
-MST_Result* prim_mst(Graph* graph, int start_vertex) {
-    if (!graph) {
-        error_exit("Graph is NULL");
+static void reset_mst_result(MST_Result* result) {
+    for (int i = 0; i < result->vertex_count; i++) {
+        result->parent[i] = -1;
+        result->key[i] = INF;
     }
+    result->total_weight = 0;
+}
 
-    if (start_vertex < 0 || start_vertex >= graph->vertices) {
-        error_exit("Invalid start vertex");
+static MST_Forest* create_mst_forest(MST_Result* tree) {
+    MST_Forest* forest = (MST_Forest*)safe_malloc(sizeof(MST_Forest));
+    int vertices = tree->vertex_count;
+
+    forest->tree = tree;
+    forest->component = (int*)safe_malloc(vertices * sizeof(int));
+    forest->root = (int*)safe_malloc(vertices * sizeof(int));
+    forest->component_weight = (long long*)safe_malloc(vertices * sizeof(long long));
+    forest->component_count = 0;
+
+    for (int i = 0; i < vertices; i++) {
+        forest->component[i] = -1;
     }
 
-    if (!is_connected(graph)) {
-        error_exit("Graph is not connected");
+    return forest;
+}
+
+static void forest_add_vertex(MST_Forest* forest, int u) {
+    MST_Result* tree = forest->tree;
+
+    if (tree->parent[u] == -1) {
+        forest->root[forest->component_count] = u;
+        forest->component_weight[forest->component_count] = 0;
+        forest->component_count++;
+    }
+
+    int component = forest->component_count - 1;
+    forest->component[u] = component;
+    forest->component_weight[component] += tree->key[u];
+}
+
+static void finish_mst_forest(MST_Forest* forest) {
+    int count = forest->component_count > 0 ? forest->component_count : 1;
+
+    forest->root = (int*)safe_realloc(forest->root, count * sizeof(int));
+    forest->component_weight = (long long*)safe_realloc(forest->component_weight,
+                                                          count * sizeof(long long));
+
+    debug_print("Spanning forest has %d components, total weight %lld",
+               forest->component_count, forest->tree->total_weight);
+}
+
+static void build_from_edges(MST_Result* result, MST_Forest* forest, int root,
+                             int edge_count, const int* src, const int* dest, const int* weight) {
+    int vertices = result->vertex_count;
+    CSRGraph* tree = create_csr_graph(vertices, edge_count, src, dest, weight);
+    if (!tree) {
+        error_exit("Invalid spanning tree edges");
+    }
+
+    bool* visited = (bool*)safe_malloc(vertices * sizeof(bool));
+    for (int i = 0; i < vertices; i++) {
+        visited[i] = false;
+    }
+
+    int* queue = (int*)safe_malloc(vertices * sizeof(int));
+    int next_root = 0;
+
+    while (root >= 0) {
+        int head = 0;
+        int tail = 0;
+
+        queue[tail++] = root;
+        visited[root] = true;
+        result->key[root] = 0;
+
+        while (head < tail) {
+            int u = queue[head++];
+
+            if (forest) {
+                forest_add_vertex(forest, u);
+            }
+
+            for (int e = tree->offsets[u]; e < tree->offsets[u + 1]; e++) {
+                int v = tree->neighbors[e];
+                if (!visited[v]) {
+                    visited[v] = true;
+                    result->parent[v] = u;
+                    result->key[v] = tree->weights[e];
+                    result->total_weight += tree->weights[e];
+                    queue[tail++] = v;
+                }
+            }
+        }
+
+        root = -1;
+        if (forest) {
+            while (next_root < vertices && visited[next_root]) {
+                next_root++;
+            }
+            if (next_root < vertices) {
+                root = next_root;
+            }
+        }
+    }
+
+    safe_free((void**)&visited);
+    safe_free((void**)&queue);
+    destroy_csr_graph(tree);
+}
+
+MST_Result* mst_result_from_edges(int vertices, int root, int edge_count,
+                                  const int* src, const int* dest, const int* weight) {
+    if (root < 0 || root >= vertices) {
+        error_exit("Invalid start vertex");
     }
 
-    int vertices = graph->vertices;
     MST_Result* result = create_mst_result(vertices);
+    build_from_edges(result, NULL, root, edge_count, src, dest, weight);
 
-    PriorityQueue* pq = create_pq(vertices);
+    return result;
+}
 
-    bool* in_mst = (bool*)safe_malloc(vertices * sizeof(bool));
+MST_Forest* mst_forest_from_edges(int vertices, int root, int edge_count,
+                                  const int* src, const int* dest, const int* weight) {
+    if (root < 0 || root >= vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    MST_Forest* forest = create_mst_forest(create_mst_result(vertices));
+    build_from_edges(forest->tree, forest, root, edge_count, src, dest, weight);
+    finish_mst_forest(forest);
+
+    return forest;
+}
+
+MST_Result* prim_mst(Graph* graph, int start_vertex) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    return prim_mst_with_pq(graph, start_vertex, pq_select_backend(graph->max_weight));
+}
+
+static int run_heap_prim(Graph* graph, int start_vertex, PriorityQueue* pq, bool* in_mst,
+                         MST_Result* result, MST_Forest* forest, bool spanning_forest) {
+    int vertices = graph->vertices;
+    int components = 1;
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SETUP);
     for (int i = 0; i < vertices; i++) {
         in_mst[i] = false;
     }
 
     result->key[start_vertex] = 0;
     for (int i = 0; i < vertices; i++) {
-        insert_pq(pq, i, result->key[i]);
+        pq_push(pq, i, result->key[i]);
     }
+    INSTR_PHASE_END(INSTR_PHASE_SETUP);
 
-    debug_print("Starting Prim's algorithm from vertex %d", start_vertex);
+    debug_print("Starting Prim's algorithm (%s heap) from vertex %d",
+               pq_backend_name(pq->backend), start_vertex);
 
-    while (!is_empty_pq(pq)) {
-        int u = extract_min(pq);
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SOLVE);
+    while (pq->size > 0) {
+        int u = pq_pop_min(pq);
         in_mst[u] = true;
 
-        debug_print("Added vertex %d to MST (key: %d)", u, result->key[u]);
+        if (result->key[u] == INF) {
+            if (!spanning_forest) {
+                error_exit("Graph is not connected");
+            }
+            result->key[u] = 0;
+            components++;
+        }
 
-        if (u != start_vertex) {
-            result->total_weight += result->key[u];
+        if (forest) {
+            forest_add_vertex(forest, u);
         }
 
-        for (int v = 0; v < vertices; v++) {
-            if (graph->adj_matrix[u][v] != INF &&
-                !in_mst[v] &&
-                is_in_pq(pq, v) &&
-                graph->adj_matrix[u][v] < result->key[v]) {
+        debug_print("Added vertex %d to MST (key: %d)", u, result->key[u]);
 
+        result->total_weight += result->key[u];
+
+        const int* row = graph_row(graph, u);
+        for (int v = 0; v < vertices; v++) {
+            if (row[v] < result->key[v] && !in_mst[v]) {
                 result->parent[v] = u;
-                result->key[v] = graph->adj_matrix[u][v];
-                decrease_key(pq, v, result->key[v]);
+                result->key[v] = row[v];
+                pq_lower_key(pq, v, row[v]);
+                INSTR_COUNT(INSTR_RELAX_TAKEN);
 
                 debug_print("Updated vertex %d: parent=%d, key=%d",
                            v, result->parent[v], result->key[v]);
             }
         }
+        INSTR_ADD(INSTR_RELAX_SCANNED, vertices);
     }
+    INSTR_PHASE_END(INSTR_PHASE_SOLVE);
+
+    debug_print("Prim's algorithm completed. Total weight: %lld", result->total_weight);
+    return components;
+}
+
+MST_Result* prim_mst_with_pq(Graph* graph, int start_vertex, PQBackend backend) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    if (start_vertex < 0 || start_vertex >= graph->vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    MST_Result* result = create_mst_result(graph->vertices);
+    PriorityQueue* pq = create_pq_bounded(graph->vertices, backend, graph->max_weight);
+    bool* in_mst = (bool*)safe_malloc(graph->vertices * sizeof(bool));
+
+    run_heap_prim(graph, start_vertex, pq, in_mst, result, NULL, false);
 
     safe_free((void**)&in_mst);
     destroy_pq(pq);
-
-    debug_print("Prim's algorithm completed. Total weight: %d", result->total_weight);
     return result;
 }
 
-MST_Result* prim_mst_simple(Graph* graph, int start_vertex) {
+MST_Forest* prim_msf(Graph* graph, int start_vertex) {
     if (!graph) {
         error_exit("Graph is NULL");
     }
@@ -88,8 +249,26 @@ MST_Result* prim_mst_simple(Graph* graph, int start_vertex) {
         error_exit("Invalid start vertex");
     }
 
-    if (!is_connected(graph)) {
-        error_exit("Graph is not connected");
+    MST_Forest* forest = create_mst_forest(create_mst_result(graph->vertices));
+    PriorityQueue* pq = create_pq_bounded(graph->vertices, pq_select_backend(graph->max_weight),
+                                          graph->max_weight);
+    bool* in_mst = (bool*)safe_malloc(graph->vertices * sizeof(bool));
+
+    run_heap_prim(graph, start_vertex, pq, in_mst, forest->tree, forest, true);
+    finish_mst_forest(forest);
+
+    safe_free((void**)&in_mst);
+    destroy_pq(pq);
+    return forest;
+}
+
+MST_Result* prim_mst_simple(Graph* graph, int start_vertex) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    if (start_vertex < 0 || start_vertex >= graph->vertices) {
+        error_exit("Invalid start vertex");
     }
 
     int vertices = graph->vertices;
@@ -106,6 +285,7 @@ MST_Result* prim_mst_simple(Graph* graph, int start_vertex) {
 
     debug_print("Starting simple Prim's algorithm from vertex %d", start_vertex);
 
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SOLVE);
     for (int count = 0; count < vertices; count++) {
         int min_key = INF;
         int u = -1;
@@ -128,26 +308,215 @@ MST_Result* prim_mst_simple(Graph* graph, int start_vertex) {
 
         debug_print("Added vertex %d to MST (key: %d)", u, result->key[u]);
 
+        const int* row = graph_row(graph, u);
         for (int v = 0; v < vertices; v++) {
-            if (graph->adj_matrix[u][v] != INF &&
+            if (row[v] != INF &&
                 !in_mst[v] &&
-                graph->adj_matrix[u][v] < result->key[v]) {
+                row[v] < result->key[v]) {
 
                 result->parent[v] = u;
-                result->key[v] = graph->adj_matrix[u][v];
+                result->key[v] = row[v];
+                INSTR_COUNT(INSTR_RELAX_TAKEN);
 
                 debug_print("Updated vertex %d: parent=%d, key=%d",
                            v, result->parent[v], result->key[v]);
             }
         }
+        INSTR_ADD(INSTR_RELAX_SCANNED, vertices);
+        INSTR_ADD(INSTR_COMPARISONS, vertices);
     }
+    INSTR_PHASE_END(INSTR_PHASE_SOLVE);
 
     safe_free((void**)&in_mst);
 
-    debug_print("Simple Prim's algorithm completed. Total weight: %d", result->total_weight);
+    debug_print("Simple Prim's algorithm completed. Total weight: %lld", result->total_weight);
     return result;
 }
 
+MST_Result* prim_mst_csr(CSRGraph* graph, int start_vertex) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    return prim_mst_csr_with_pq(graph, start_vertex, pq_select_backend(graph->max_weight));
+}
+
+static void run_csr_prim(CSRGraph* graph, int start_vertex, PriorityQueue* pq,
+                         bool* in_mst, MST_Result* result, MST_Forest* forest) {
+    int vertices = graph->vertices;
+
+    for (int i = 0; i < vertices; i++) {
+        in_mst[i] = false;
+    }
+
+    debug_print("Starting CSR Prim's algorithm (%s heap) from vertex %d",
+               pq_backend_name(pq->backend), start_vertex);
+
+    int visited_count = 0;
+    int next_root = 0;
+    int root = start_vertex;
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SOLVE);
+    while (true) {
+        result->key[root] = 0;
+        pq_push(pq, root, 0);
+
+        while (pq->size > 0) {
+            int u = pq_pop_min(pq);
+            in_mst[u] = true;
+            visited_count++;
+
+            if (forest) {
+                forest_add_vertex(forest, u);
+            }
+
+            debug_print("Added vertex %d to MST (key: %d)", u, result->key[u]);
+
+            result->total_weight += result->key[u];
+
+            for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+                int v = graph->neighbors[e];
+                int weight = graph->weights[e];
+
+                if (weight < result->key[v] && !in_mst[v]) {
+                    if (result->key[v] == INF) {
+                        pq_push(pq, v, weight);
+                    } else {
+                        pq_lower_key(pq, v, weight);
+                    }
+
+                    result->parent[v] = u;
+                    result->key[v] = weight;
+                    INSTR_COUNT(INSTR_RELAX_TAKEN);
+
+                    debug_print("Updated vertex %d: parent=%d, key=%d",
+                               v, result->parent[v], result->key[v]);
+                }
+            }
+            INSTR_ADD(INSTR_RELAX_SCANNED, graph->offsets[u + 1] - graph->offsets[u]);
+        }
+
+        if (visited_count == vertices) {
+            break;
+        }
+
+        if (!forest) {
+            error_exit("Graph is not connected");
+        }
+
+        while (in_mst[next_root]) {
+            next_root++;
+        }
+        root = next_root;
+    }
+    INSTR_PHASE_END(INSTR_PHASE_SOLVE);
+
+    debug_print("CSR Prim's algorithm completed. Total weight: %lld", result->total_weight);
+}
+
+MST_Result* prim_mst_csr_with_pq(CSRGraph* graph, int start_vertex, PQBackend backend) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    if (start_vertex < 0 || start_vertex >= graph->vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    MST_Result* result = create_mst_result(graph->vertices);
+    PriorityQueue* pq = create_pq_bounded(graph->vertices, backend, graph->max_weight);
+    bool* in_mst = (bool*)safe_malloc(graph->vertices * sizeof(bool));
+
+    run_csr_prim(graph, start_vertex, pq, in_mst, result, NULL);
+
+    safe_free((void**)&in_mst);
+    destroy_pq(pq);
+    return result;
+}
+
+MST_Forest* prim_msf_csr(CSRGraph* graph, int start_vertex) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    if (start_vertex < 0 || start_vertex >= graph->vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    MST_Forest* forest = create_mst_forest(create_mst_result(graph->vertices));
+    PriorityQueue* pq = create_pq_bounded(graph->vertices, pq_select_backend(graph->max_weight),
+                                          graph->max_weight);
+    bool* in_mst = (bool*)safe_malloc(graph->vertices * sizeof(bool));
+
+    run_csr_prim(graph, start_vertex, pq, in_mst, forest->tree, forest);
+    finish_mst_forest(forest);
+
+    safe_free((void**)&in_mst);
+    destroy_pq(pq);
+    return forest;
+}
+
+static void check_into_arguments(MSTWorkspace* workspace, int vertices, int start_vertex,
+                                 MST_Result* result) {
+    if (!workspace || !result) {
+        error_exit("Workspace or MST result is NULL");
+    }
+
+    if (start_vertex < 0 || start_vertex >= vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    if (result->vertex_count != vertices || !result->parent || !result->key) {
+        error_exit("MST result buffers do not match graph");
+    }
+}
+
+static int heap_prim_into(MSTWorkspace* workspace, Graph* graph, int start_vertex,
+                          MST_Result* result, bool spanning_forest) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    check_into_arguments(workspace, graph->vertices, start_vertex, result);
+    reset_mst_result(result);
+    mst_workspace_reset(workspace);
+
+    PriorityQueue* pq = mst_workspace_queue(workspace, graph->vertices,
+                                            pq_select_backend(graph->max_weight),
+                                            graph->max_weight);
+    bool* in_mst = (bool*)arena_alloc(mst_workspace_arena(workspace),
+                                      graph->vertices * sizeof(bool));
+
+    return run_heap_prim(graph, start_vertex, pq, in_mst, result, NULL, spanning_forest);
+}
+
+void prim_mst_into(MSTWorkspace* workspace, Graph* graph, int start_vertex, MST_Result* result) {
+    heap_prim_into(workspace, graph, start_vertex, result, false);
+}
+
+int prim_msf_into(MSTWorkspace* workspace, Graph* graph, int start_vertex, MST_Result* result) {
+    return heap_prim_into(workspace, graph, start_vertex, result, true);
+}
+
+void prim_mst_csr_into(MSTWorkspace* workspace, CSRGraph* graph, int start_vertex,
+                       MST_Result* result) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    check_into_arguments(workspace, graph->vertices, start_vertex, result);
+    reset_mst_result(result);
+    mst_workspace_reset(workspace);
+
+    PriorityQueue* pq = mst_workspace_queue(workspace, graph->vertices,
+                                            pq_select_backend(graph->max_weight),
+                                            graph->max_weight);
+    bool* in_mst = (bool*)arena_alloc(mst_workspace_arena(workspace),
+                                      graph->vertices * sizeof(bool));
+
+    run_csr_prim(graph, start_vertex, pq, in_mst, result, NULL);
+}
+
 void print_mst(MST_Result* result) {
     if (!result) {
         printf("MST Result is NULL\n");
@@ -164,7 +533,7 @@ void print_mst(MST_Result* result) {
         }
     }
 
-    printf("\nTotal weight of MST: %d\n", result->total_weight);
+    printf("\nTotal weight of MST: %lld\n", result->total_weight);
     printf("Number of edges: %d\n", result->vertex_count - 1);
 }
 
@@ -178,7 +547,7 @@ bool validate_mst(Graph* graph, MST_Result* result) {
     }
 
     int edge_count = 0;
-    int calculated_weight = 0;
+    long long calculated_weight = 0;
 
     for (int i = 0; i < result->vertex_count; i++) {
         if (result->parent[i] != -1) {
@@ -189,9 +558,64 @@ bool validate_mst(Graph* graph, MST_Result* result) {
                 return false;
             }
 
-            if (graph->adj_matrix[result->parent[i]][i] != result->key[i]) {
+            if (graph_weight(graph, result->parent[i], i) != result->key[i]) {
                 debug_print("Edge weight mismatch: expected %d, got %d",
-                           graph->adj_matrix[result->parent[i]][i], result->key[i]);
+                           graph_weight(graph, result->parent[i], i), result->key[i]);
+                return false;
+            }
+
+            calculated_weight += result->key[i];
+        }
+    }
+
+    if (edge_count != result->vertex_count - 1) {
+        debug_print("Wrong number of edges: expected %d, got %d",
+                   result->vertex_count - 1, edge_count);
+        return false;
+    }
+
+    if (calculated_weight != result->total_weight) {
+        debug_print("Total weight mismatch: expected %lld, got %lld",
+                   calculated_weight, result->total_weight);
+        return false;
+    }
+
+    return true;
+}
+
+bool validate_mst_csr(CSRGraph* graph, MST_Result* result) {
+    if (!graph || !result) {
+        return false;
+    }
+
+    if (graph->vertices != result->vertex_count) {
+        return false;
+    }
+
+    int edge_count = 0;
+    long long calculated_weight = 0;
+
+    for (int i = 0; i < result->vertex_count; i++) {
+        if (result->parent[i] != -1) {
+            edge_count++;
+
+            if (result->parent[i] < 0 || result->parent[i] >= graph->vertices) {
+                debug_print("Invalid parent index: %d", result->parent[i]);
+                return false;
+            }
+
+            bool found = false;
+            for (int e = graph->offsets[i]; e < graph->offsets[i + 1]; e++) {
+                if (graph->neighbors[e] == result->parent[i] &&
+                    graph->weights[e] == result->key[i]) {
+                    found = true;
+                    break;
+                }
+            }
+
+            if (!found) {
+                debug_print("Edge %d -- %d with weight %d not in graph",
+                           result->parent[i], i, result->key[i]);
                 return false;
             }
 
@@ -206,7 +630,7 @@ bool validate_mst(Graph* graph, MST_Result* result) {
     }
 
     if (calculated_weight != result->total_weight) {
-        debug_print("Total weight mismatch: expected %d, got %d",
+        debug_print("Total weight mismatch: expected %lld, got %lld",
                    calculated_weight, result->total_weight);
         return false;
     }
@@ -224,4 +648,16 @@ void destroy_mst_result(MST_Result* result) {
 
     debug_print("Destroyed MST result with %d vertices", result->vertex_count);
     safe_free((void**)&result);
+}
+
+void destroy_mst_forest(MST_Forest* forest) {
+    if (!forest) {
+        return;
+    }
+
+    destroy_mst_result(forest->tree);
+    safe_free((void**)&forest->component);
+    safe_free((void**)&forest->root);
+    safe_free((void**)&forest->component_weight);
+    safe_free((void**)&forest);
 }
\ No newline at end of file
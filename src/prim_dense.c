@@ -0,0 +1,489 @@
+#include "prim_dense.h"
+#include "instrument.h"
+#include "thread_pool.h"
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PRIM_DENSE_X86 1
+#include <immintrin.h>
+#endif
+
+typedef int (*RelaxMinFn)(const int* row, int* key, int* parent,
+                          const int* done, int u, int n);
+typedef int (*FindMinFn)(const int* key, const int* done, int n, int min_key);
+
+#define DENSE_BLOCK (CACHE_LINE_SIZE / (int)sizeof(int))
+
+typedef struct DenseSlot {
+    int min_key;
+    int vertex;
+    char padding[CACHE_LINE_SIZE - 2 * sizeof(int)];
+} DenseSlot;
+
+typedef struct DenseParallelState {
+    Graph *graph;
+    CSRGraph *csr;
+    int *scratch;
+    int vertices;
+    int stride;
+    ThreadPool *pool;
+    RelaxMinFn relax_min;
+    FindMinFn find_min;
+    int *key;
+    int *parent;
+    int *done;
+    DenseSlot *slots;
+    int start_vertex;
+    long long total_weight;
+    bool disconnected;
+} DenseParallelState;
+
+static int relax_min_scalar(const int* row, int* key, int* parent,
+                            const int* done, int u, int n) {
+    int min_key = INT_MAX;
+
+    for (int v = 0; v < n; v++) {
+        if (!done[v]) {
+            if (row[v] < key[v]) {
+                key[v] = row[v];
+                parent[v] = u;
+            }
+            if (key[v] < min_key) {
+                min_key = key[v];
+            }
+        }
+    }
+
+    return min_key;
+}
+
+static int find_min_scalar(const int* key, const int* done, int n, int min_key) {
+    for (int v = 0; v < n; v++) {
+        if (!done[v] && key[v] == min_key) {
+            return v;
+        }
+    }
+    return -1;
+}
+
+#ifdef PRIM_DENSE_X86
+
+__attribute__((target("sse2")))
+static inline __m128i min_epi32_sse2(__m128i a, __m128i b) {
+    __m128i a_greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(a_greater, b), _mm_andnot_si128(a_greater, a));
+}
+
+__attribute__((target("sse2")))
+static inline __m128i blend_epi32_sse2(__m128i a, __m128i b, __m128i mask) {
+    return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+}
+
+__attribute__((target("sse2")))
+static int relax_min_sse2(const int* row, int* key, int* parent,
+                          const int* done, int u, int n) {
+    const __m128i vertex = _mm_set1_epi32(u);
+    const __m128i max_key = _mm_set1_epi32(INT_MAX);
+    __m128i best = max_key;
+
+    for (int v = 0; v < n; v += 4) {
+        __m128i w = _mm_load_si128((const __m128i*)(row + v));
+        __m128i k = _mm_load_si128((const __m128i*)(key + v));
+        __m128i d = _mm_load_si128((const __m128i*)(done + v));
+
+        __m128i take = _mm_andnot_si128(d, _mm_cmpgt_epi32(k, w));
+        if (_mm_movemask_epi8(take)) {
+            __m128i p = _mm_load_si128((const __m128i*)(parent + v));
+            k = blend_epi32_sse2(k, w, take);
+            _mm_store_si128((__m128i*)(key + v), k);
+            _mm_store_si128((__m128i*)(parent + v), blend_epi32_sse2(p, vertex, take));
+        }
+
+        best = min_epi32_sse2(best, _mm_or_si128(k, _mm_and_si128(d, max_key)));
+    }
+
+    best = min_epi32_sse2(best, _mm_shuffle_epi32(best, _MM_SHUFFLE(1, 0, 3, 2)));
+    best = min_epi32_sse2(best, _mm_shuffle_epi32(best, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(best);
+}
+
+__attribute__((target("sse2")))
+static int find_min_sse2(const int* key, const int* done, int n, int min_key) {
+    const __m128i target = _mm_set1_epi32(min_key);
+    const __m128i max_key = _mm_set1_epi32(INT_MAX);
+
+    for (int v = 0; v < n; v += 4) {
+        __m128i k = _mm_load_si128((const __m128i*)(key + v));
+        __m128i d = _mm_load_si128((const __m128i*)(done + v));
+        __m128i masked = _mm_or_si128(k, _mm_and_si128(d, max_key));
+        int hits = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(masked, target)));
+        if (hits) {
+            return v + __builtin_ctz(hits);
+        }
+    }
+    return -1;
+}
+
+__attribute__((target("avx2")))
+static int relax_min_avx2(const int* row, int* key, int* parent,
+                          const int* done, int u, int n) {
+    const __m256i vertex = _mm256_set1_epi32(u);
+    const __m256i max_key = _mm256_set1_epi32(INT_MAX);
+    __m256i best = max_key;
+
+    for (int v = 0; v < n; v += 8) {
+        __m256i w = _mm256_load_si256((const __m256i*)(row + v));
+        __m256i k = _mm256_load_si256((const __m256i*)(key + v));
+        __m256i d = _mm256_load_si256((const __m256i*)(done + v));
+
+        __m256i take = _mm256_andnot_si256(d, _mm256_cmpgt_epi32(k, w));
+        if (!_mm256_testz_si256(take, take)) {
+            __m256i p = _mm256_load_si256((const __m256i*)(parent + v));
+            k = _mm256_blendv_epi8(k, w, take);
+            _mm256_store_si256((__m256i*)(key + v), k);
+            _mm256_store_si256((__m256i*)(parent + v), _mm256_blendv_epi8(p, vertex, take));
+        }
+
+        best = _mm256_min_epi32(best, _mm256_or_si256(k, _mm256_and_si256(d, max_key)));
+    }
+
+    __m128i half = _mm_min_epi32(_mm256_castsi256_si128(best),
+                                 _mm256_extracti128_si256(best, 1));
+    half = _mm_min_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+    half = _mm_min_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(half);
+}
+
+__attribute__((target("avx2")))
+static int find_min_avx2(const int* key, const int* done, int n, int min_key) {
+    const __m256i target = _mm256_set1_epi32(min_key);
+    const __m256i max_key = _mm256_set1_epi32(INT_MAX);
+
+    for (int v = 0; v < n; v += 8) {
+        __m256i k = _mm256_load_si256((const __m256i*)(key + v));
+        __m256i d = _mm256_load_si256((const __m256i*)(done + v));
+        __m256i masked = _mm256_or_si256(k, _mm256_and_si256(d, max_key));
+        int hits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(masked, target)));
+        if (hits) {
+            return v + __builtin_ctz(hits);
+        }
+    }
+    return -1;
+}
+
+#endif
+
+DenseKernel dense_kernel_detect(void) {
+#ifdef PRIM_DENSE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return DENSE_KERNEL_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return DENSE_KERNEL_SSE2;
+    }
+#endif
+    return DENSE_KERNEL_SCALAR;
+}
+
+bool dense_kernel_supported(DenseKernel kernel) {
+    switch (kernel) {
+        case DENSE_KERNEL_AUTO:
+        case DENSE_KERNEL_SCALAR:
+            return true;
+        case DENSE_KERNEL_SSE2:
+            return dense_kernel_detect() >= DENSE_KERNEL_SSE2;
+        case DENSE_KERNEL_AVX2:
+            return dense_kernel_detect() >= DENSE_KERNEL_AVX2;
+    }
+    return false;
+}
+
+const char* dense_kernel_name(DenseKernel kernel) {
+    switch (kernel) {
+        case DENSE_KERNEL_AUTO:
+            return "auto";
+        case DENSE_KERNEL_SCALAR:
+            return "scalar";
+        case DENSE_KERNEL_SSE2:
+            return "sse2";
+        case DENSE_KERNEL_AVX2:
+            return "avx2";
+    }
+    return "unknown";
+}
+
+static DenseKernel select_kernel(DenseKernel kernel, RelaxMinFn* relax_min, FindMinFn* find_min) {
+    if (kernel == DENSE_KERNEL_AUTO) {
+        kernel = dense_kernel_detect();
+    }
+
+    if (!dense_kernel_supported(kernel)) {
+        error_exit("Dense kernel not supported by this CPU");
+    }
+
+    *relax_min = relax_min_scalar;
+    *find_min = find_min_scalar;
+#ifdef PRIM_DENSE_X86
+    if (kernel == DENSE_KERNEL_AVX2) {
+        *relax_min = relax_min_avx2;
+        *find_min = find_min_avx2;
+    } else if (kernel == DENSE_KERNEL_SSE2) {
+        *relax_min = relax_min_sse2;
+        *find_min = find_min_sse2;
+    }
+#endif
+
+    return kernel;
+}
+
+static int dense_stride(int vertices) {
+    return (vertices + DENSE_BLOCK - 1) / DENSE_BLOCK * DENSE_BLOCK;
+}
+
+static const int* scatter_csr_row(const CSRGraph* csr, int u, int* row, int begin, int end) {
+    for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+        int v = csr->neighbors[k];
+        if (v >= begin && v < end) {
+            int w = csr->weights[k];
+            row[v] = w < row[v] ? w : row[v];
+        }
+    }
+    return row + begin;
+}
+
+static void clear_scratch_row(int* row, int begin, int end) {
+    for (int v = begin; v < end; v++) {
+        row[v] = INF;
+    }
+}
+
+static int* create_scratch_row(int n) {
+    int* row = (int*)safe_aligned_malloc(CACHE_LINE_SIZE, n * sizeof(int));
+    clear_scratch_row(row, 0, n);
+    return row;
+}
+
+static void init_dense_arrays(int* key, int* parent, int* done,
+                              int vertices, int n, int start_vertex) {
+    for (int v = 0; v < n; v++) {
+        key[v] = INF;
+        parent[v] = -1;
+        done[v] = (v < vertices) ? 0 : -1;
+    }
+    key[start_vertex] = 0;
+}
+
+MST_Result* prim_mst_dense(Graph* graph, int start_vertex) {
+    return prim_mst_dense_kernel(graph, start_vertex, DENSE_KERNEL_AUTO);
+}
+
+static MST_Result* dense_prim(Graph* graph, CSRGraph* csr, int start_vertex, DenseKernel kernel) {
+    int vertices = graph ? graph->vertices : csr->vertices;
+    if (start_vertex < 0 || start_vertex >= vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    RelaxMinFn relax_min;
+    FindMinFn find_min;
+    kernel = select_kernel(kernel, &relax_min, &find_min);
+
+    int n = graph ? graph->stride : dense_stride(vertices);
+    int* scratch = csr ? create_scratch_row(n) : NULL;
+    MST_Result* result = create_mst_result(vertices);
+
+    int* key = (int*)safe_aligned_malloc(CACHE_LINE_SIZE, n * sizeof(int));
+    int* parent = (int*)safe_aligned_malloc(CACHE_LINE_SIZE, n * sizeof(int));
+    int* done = (int*)safe_aligned_malloc(CACHE_LINE_SIZE, n * sizeof(int));
+    init_dense_arrays(key, parent, done, vertices, n, start_vertex);
+
+    debug_print("Starting dense Prim's algorithm (%s) from vertex %d",
+               dense_kernel_name(kernel), start_vertex);
+
+    INSTR_PHASE_BEGIN(INSTR_PHASE_SOLVE);
+    int u = start_vertex;
+    for (int count = 0; count < vertices; count++) {
+        done[u] = -1;
+        if (u != start_vertex) {
+            result->total_weight += key[u];
+        }
+
+        debug_print("Added vertex %d to MST (key: %d)", u, key[u]);
+
+        if (count == vertices - 1) {
+            break;
+        }
+
+        const int* row = csr ? scatter_csr_row(csr, u, scratch, 0, n) : graph_row(graph, u);
+        int min_key = relax_min(row, key, parent, done, u, n);
+        INSTR_ADD(INSTR_RELAX_SCANNED, n);
+        if (csr) {
+            clear_scratch_row(scratch, 0, n);
+        }
+        if (min_key >= INF) {
+            error_exit("Graph is not connected");
+        }
+
+        u = find_min(key, done, n, min_key);
+    }
+    INSTR_PHASE_END(INSTR_PHASE_SOLVE);
+
+    memcpy(result->key, key, vertices * sizeof(int));
+    memcpy(result->parent, parent, vertices * sizeof(int));
+
+    safe_free((void**)&key);
+    safe_free((void**)&parent);
+    safe_free((void**)&done);
+    safe_free((void**)&scratch);
+
+    debug_print("Dense Prim's algorithm completed. Total weight: %lld", result->total_weight);
+    return result;
+}
+
+MST_Result* prim_mst_dense_kernel(Graph* graph, int start_vertex, DenseKernel kernel) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    return dense_prim(graph, NULL, start_vertex, kernel);
+}
+
+MST_Result* prim_mst_dense_csr(CSRGraph* graph, int start_vertex) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    return dense_prim(NULL, graph, start_vertex, DENSE_KERNEL_AUTO);
+}
+
+static void dense_parallel_task(void* arg, int thread_id, int thread_count) {
+    DenseParallelState* state = (DenseParallelState*)arg;
+    int vertices = state->vertices;
+
+    int begin, end;
+    thread_chunk(state->stride / DENSE_BLOCK, thread_id, thread_count, &begin, &end);
+    begin *= DENSE_BLOCK;
+    end *= DENSE_BLOCK;
+    int length = end - begin;
+
+    int* key = state->key + begin;
+    int* parent = state->parent + begin;
+    int* done = state->done + begin;
+
+    long long local_weight = 0;
+    int u = state->start_vertex;
+    for (int count = 0; count < vertices; count++) {
+        if (u >= begin && u < end) {
+            done[u - begin] = -1;
+            if (u != state->start_vertex) {
+                local_weight += key[u - begin];
+            }
+        }
+
+        if (count == vertices - 1) {
+            break;
+        }
+
+        const int* row = state->csr
+            ? scatter_csr_row(state->csr, u, state->scratch, begin, end)
+            : graph_row(state->graph, u) + begin;
+        int local_min = state->relax_min(row, key, parent, done, u, length);
+        INSTR_ADD(INSTR_RELAX_SCANNED, length);
+        if (state->csr) {
+            clear_scratch_row(state->scratch, begin, end);
+        }
+        DenseSlot* slot = &state->slots[(count & 1) * thread_count + thread_id];
+        slot->min_key = local_min;
+        slot->vertex = (local_min < INF) ? begin + state->find_min(key, done, length, local_min) : -1;
+
+        thread_pool_barrier(state->pool, thread_id);
+
+        int min_key = INF;
+        u = -1;
+        for (int t = 0; t < thread_count; t++) {
+            const DenseSlot* other = &state->slots[(count & 1) * thread_count + t];
+            if (other->min_key < min_key) {
+                min_key = other->min_key;
+                u = other->vertex;
+            }
+        }
+
+        if (u == -1) {
+            if (thread_id == 0) {
+                state->disconnected = true;
+            }
+            break;
+        }
+    }
+
+    __atomic_fetch_add(&state->total_weight, local_weight, __ATOMIC_RELAXED);
+}
+
+static MST_Result* dense_prim_parallel(Graph* graph, CSRGraph* csr, int start_vertex, int thread_count) {
+    int vertices = graph ? graph->vertices : csr->vertices;
+    if (start_vertex < 0 || start_vertex >= vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    DenseParallelState state;
+    DenseKernel kernel = select_kernel(DENSE_KERNEL_AUTO, &state.relax_min, &state.find_min);
+
+    int n = graph ? graph->stride : dense_stride(vertices);
+
+    state.graph = graph;
+    state.csr = csr;
+    state.scratch = csr ? create_scratch_row(n) : NULL;
+    state.vertices = vertices;
+    state.stride = n;
+    state.pool = create_thread_pool(thread_count);
+    state.start_vertex = start_vertex;
+    state.total_weight = 0;
+    state.disconnected = false;
+    thread_count = thread_pool_size(state.pool);
+
+    state.key = (int*)safe_aligned_malloc(CACHE_LINE_SIZE, n * sizeof(int));
+    state.parent = (int*)safe_aligned_malloc(CACHE_LINE_SIZE, n * sizeof(int));
+    state.done = (int*)safe_aligned_malloc(CACHE_LINE_SIZE, n * sizeof(int));
+    state.slots = (DenseSlot*)safe_aligned_malloc(CACHE_LINE_SIZE, 2 * thread_count * sizeof(DenseSlot));
+    init_dense_arrays(state.key, state.parent, state.done, vertices, n, start_vertex);
+
+    debug_print("Starting parallel dense Prim's algorithm (%s, %d threads) from vertex %d",
+               dense_kernel_name(kernel), thread_count, start_vertex);
+
+    thread_pool_run(state.pool, dense_parallel_task, &state);
+    destroy_thread_pool(state.pool);
+
+    if (state.disconnected) {
+        error_exit("Graph is not connected");
+    }
+
+    MST_Result* result = create_mst_result(vertices);
+    memcpy(result->key, state.key, vertices * sizeof(int));
+    memcpy(result->parent, state.parent, vertices * sizeof(int));
+    result->total_weight = state.total_weight;
+
+    safe_free((void**)&state.key);
+    safe_free((void**)&state.parent);
+    safe_free((void**)&state.done);
+    safe_free((void**)&state.slots);
+    safe_free((void**)&state.scratch);
+
+    debug_print("Parallel dense Prim's algorithm completed. Total weight: %lld", result->total_weight);
+    return result;
+}
+
+MST_Result* prim_mst_dense_parallel(Graph* graph, int start_vertex, int thread_count) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    return dense_prim_parallel(graph, NULL, start_vertex, thread_count);
+}
+
+MST_Result* prim_mst_dense_parallel_csr(CSRGraph* graph, int start_vertex, int thread_count) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    return dense_prim_parallel(NULL, graph, start_vertex, thread_count);
+}
\ No newline at end of file
@@ -1,4 +1,4 @@
-#include "priority_queue.h"
+#include "pq_backend.h"
 
 static void swap_nodes(PriorityQueue* pq, int i, int j) {
     int temp_vertex = pq->heap[i];
@@ -12,10 +12,12 @@ static void swap_nodes(PriorityQueue* pq, int i, int j) {
 static void heapify_up(PriorityQueue* pq, int idx) {
     while (idx > 0) {
         int parent = (idx - 1) / 2;
+        INSTR_COUNT(INSTR_COMPARISONS);
         if (pq->key[pq->heap[idx]] >= pq->key[pq->heap[parent]]) {
             break;
         }
         swap_nodes(pq, idx, parent);
+        INSTR_COUNT(INSTR_HEAP_SIFTS);
         idx = parent;
     }
 }
@@ -37,113 +39,189 @@ static void heapify_down(PriorityQueue* pq, int idx) {
             smallest = right;
         }
 
+        INSTR_ADD(INSTR_COMPARISONS, (left < pq->size) + (right < pq->size));
         if (smallest == idx) {
             break;
         }
 
         swap_nodes(pq, idx, smallest);
+        INSTR_COUNT(INSTR_HEAP_SIFTS);
         idx = smallest;
     }
 }
 
+static void binary_init(PriorityQueue* pq) {
+    pq->heap = (int*)safe_malloc(pq->capacity * sizeof(int));
+}
+
+static void binary_insert(PriorityQueue* pq, int vertex, int key) {
+    pq->key[vertex] = key;
+    pq->heap[pq->size] = vertex;
+    pq->pos[vertex] = pq->size;
+    pq->size++;
+
+    heapify_up(pq, pq->size - 1);
+}
+
+static int binary_extract_min(PriorityQueue* pq) {
+    int min_vertex = pq->heap[0];
+    int last_vertex = pq->heap[pq->size - 1];
+
+    pq->heap[0] = last_vertex;
+    pq->pos[last_vertex] = 0;
+    pq->pos[min_vertex] = -1;
+    pq->size--;
+
+    if (pq->size > 0) {
+        heapify_down(pq, 0);
+    }
+
+    return min_vertex;
+}
+
+static void binary_decrease_key(PriorityQueue* pq, int vertex, int new_key) {
+    pq->key[vertex] = new_key;
+    heapify_up(pq, pq->pos[vertex]);
+}
+
+static void binary_release(PriorityQueue* pq) {
+    safe_free((void**)&pq->heap);
+}
+
+const PQOps pq_binary_ops = {
+    binary_init,
+    binary_insert,
+    binary_extract_min,
+    binary_decrease_key,
+    binary_release
+};
+
+static const PQOps* backend_ops(PQBackend backend) {
+    switch (backend) {
+        case PQ_BINARY_HEAP:
+            return &pq_binary_ops;
+        case PQ_DARY4_HEAP:
+            return &pq_dary4_ops;
+        case PQ_DARY8_HEAP:
+            return &pq_dary8_ops;
+        case PQ_PAIRING_HEAP:
+            return &pq_pairing_ops;
+        case PQ_BUCKET_QUEUE:
+            return &pq_bucket_ops;
+    }
+    return NULL;
+}
+
 PriorityQueue* create_pq(int max_size) {
-    if (max_size <= 0) {
-        error_exit("Priority queue size must be positive");
+    return create_pq_backend(max_size, PQ_DEFAULT_BACKEND);
+}
+
+PriorityQueue* create_pq_backend(int max_size, PQBackend backend) {
+    return create_pq_bounded(max_size, backend, -1);
+}
+
+PriorityQueue* create_pq_bounded(int max_size, PQBackend backend, int max_key) {
+    const PQOps* ops = backend_ops(backend);
+
+    if (max_size <= 0 || !ops) {
+        return NULL;
+    }
+
+    if (backend == PQ_BUCKET_QUEUE && (max_key < 0 || max_key >= INF)) {
+        return NULL;
     }
 
     PriorityQueue* pq = (PriorityQueue*)safe_malloc(sizeof(PriorityQueue));
 
-    pq->heap = (int*)safe_malloc(max_size * sizeof(int));
+    pq->ops = ops;
+    pq->backend = backend;
+    pq->heap = NULL;
+    pq->impl = NULL;
     pq->pos = (int*)safe_malloc(max_size * sizeof(int));
     pq->key = (int*)safe_malloc(max_size * sizeof(int));
 
     pq->size = 0;
     pq->capacity = max_size;
+    pq->max_key = max_key;
 
     for (int i = 0; i < max_size; i++) {
         pq->pos[i] = -1;
         pq->key[i] = INF;
     }
 
-    debug_print("Created priority queue with capacity %d", max_size);
+    ops->init(pq);
+
+    debug_print("Created %s priority queue with capacity %d", pq_backend_name(backend), max_size);
     return pq;
 }
 
-void insert_pq(PriorityQueue* pq, int vertex, int key) {
+static bool key_in_range(PriorityQueue* pq, int key) {
+    if (pq->backend != PQ_BUCKET_QUEUE || key == INF) {
+        return true;
+    }
+    return key >= 0 && key <= pq->max_key;
+}
+
+PQStatus insert_pq(PriorityQueue* pq, int vertex, int key) {
     if (!pq) {
-        error_exit("Priority queue is NULL");
+        return PQ_ERR_NULL;
     }
 
     if (vertex < 0 || vertex >= pq->capacity) {
-        error_exit("Invalid vertex index");
+        return PQ_ERR_RANGE;
     }
 
     if (pq->size >= pq->capacity) {
-        error_exit("Priority queue is full");
+        return PQ_ERR_FULL;
     }
 
-    if (pq->pos[vertex] != -1) {
-        error_exit("Vertex already in priority queue");
+    if (pq_contains(pq, vertex)) {
+        return PQ_ERR_PRESENT;
     }
 
-    pq->key[vertex] = key;
-    pq->heap[pq->size] = vertex;
-    pq->pos[vertex] = pq->size;
-    pq->size++;
+    if (!key_in_range(pq, key)) {
+        return PQ_ERR_KEY;
+    }
 
-    heapify_up(pq, pq->size - 1);
+    pq_push(pq, vertex, key);
 
     debug_print("Inserted vertex %d with key %d", vertex, key);
+    return PQ_OK;
 }
 
 int extract_min(PriorityQueue* pq) {
-    if (!pq) {
-        error_exit("Priority queue is NULL");
-    }
-
-    if (pq->size == 0) {
-        error_exit("Priority queue is empty");
+    if (!pq || pq->size == 0) {
+        return -1;
     }
 
-    int min_vertex = pq->heap[0];
-    int last_vertex = pq->heap[pq->size - 1];
-
-    pq->heap[0] = last_vertex;
-    pq->pos[last_vertex] = 0;
-    pq->pos[min_vertex] = -1;
-    pq->size--;
-
-    if (pq->size > 0) {
-        heapify_down(pq, 0);
-    }
+    int min_vertex = pq_pop_min(pq);
 
     debug_print("Extracted min vertex %d with key %d", min_vertex, pq->key[min_vertex]);
     return min_vertex;
 }
 
-void decrease_key(PriorityQueue* pq, int vertex, int new_key) {
+PQStatus decrease_key(PriorityQueue* pq, int vertex, int new_key) {
     if (!pq) {
-        error_exit("Priority queue is NULL");
+        return PQ_ERR_NULL;
     }
 
     if (vertex < 0 || vertex >= pq->capacity) {
-        error_exit("Invalid vertex index");
+        return PQ_ERR_RANGE;
     }
 
-    if (pq->pos[vertex] == -1) {
-        error_exit("Vertex not in priority queue");
+    if (!pq_contains(pq, vertex)) {
+        return PQ_ERR_ABSENT;
     }
 
-    if (new_key > pq->key[vertex]) {
-        error_exit("New key is greater than current key");
+    if (new_key > pq->key[vertex] || !key_in_range(pq, new_key)) {
+        return PQ_ERR_KEY;
     }
 
     int old_key = pq->key[vertex];
-    pq->key[vertex] = new_key;
-
-    heapify_up(pq, pq->pos[vertex]);
+    pq_lower_key(pq, vertex, new_key);
 
     debug_print("Decreased key of vertex %d from %d to %d", vertex, old_key, new_key);
+    return PQ_OK;
 }
 
 bool is_empty_pq(PriorityQueue* pq) {
@@ -157,12 +235,55 @@ bool is_in_pq(PriorityQueue* pq, int vertex) {
     return pq->pos[vertex] != -1;
 }
 
+PQBackend pq_select_backend(int max_key) {
+    if (max_key >= 0 && max_key < PQ_BUCKET_THRESHOLD) {
+        return PQ_BUCKET_QUEUE;
+    }
+    return PQ_DEFAULT_BACKEND;
+}
+
+const char* pq_backend_name(PQBackend backend) {
+    switch (backend) {
+        case PQ_BINARY_HEAP:
+            return "binary";
+        case PQ_DARY4_HEAP:
+            return "4-ary";
+        case PQ_DARY8_HEAP:
+            return "8-ary";
+        case PQ_PAIRING_HEAP:
+            return "pairing";
+        case PQ_BUCKET_QUEUE:
+            return "bucket";
+    }
+    return "unknown";
+}
+
+const char* pq_status_name(PQStatus status) {
+    switch (status) {
+        case PQ_OK:
+            return "ok";
+        case PQ_ERR_NULL:
+            return "queue is NULL";
+        case PQ_ERR_RANGE:
+            return "vertex index out of range";
+        case PQ_ERR_FULL:
+            return "queue is full";
+        case PQ_ERR_PRESENT:
+            return "vertex already in queue";
+        case PQ_ERR_ABSENT:
+            return "vertex not in queue";
+        case PQ_ERR_KEY:
+            return "invalid key";
+    }
+    return "unknown";
+}
+
 void destroy_pq(PriorityQueue* pq) {
     if (!pq) {
         return;
     }
 
-    safe_free((void**)&pq->heap);
+    pq->ops->release(pq);
     safe_free((void**)&pq->pos);
     safe_free((void**)&pq->key);
 
@@ -0,0 +1,294 @@
+#include "reorder.h"
+
+static int degree(const CSRGraph* graph, int u) {
+    return graph->offsets[u + 1] - graph->offsets[u];
+}
+
+static int compare_packed(const void* a, const void* b) {
+    long long x = *(const long long*)a;
+    long long y = *(const long long*)b;
+    return (x > y) - (x < y);
+}
+
+static int bfs_levels(const CSRGraph* graph, int root, int* queue, int* level, int* last_level) {
+    int head = 0;
+    int tail = 0;
+
+    queue[tail++] = root;
+    level[root] = 0;
+
+    while (head < tail) {
+        int u = queue[head++];
+        for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            int v = graph->neighbors[e];
+            if (level[v] < 0) {
+                level[v] = level[u] + 1;
+                queue[tail++] = v;
+            }
+        }
+    }
+
+    *last_level = level[queue[tail - 1]];
+    return tail;
+}
+
+static int peripheral_vertex(const CSRGraph* graph, int root, int* queue, int* level) {
+    int depth = -1;
+
+    for (int pass = 0; pass < 4; pass++) {
+        int last_level;
+        int count = bfs_levels(graph, root, queue, level, &last_level);
+
+        int candidate = root;
+        for (int i = count - 1; i >= 0 && level[queue[i]] == last_level; i--) {
+            if (candidate == root || degree(graph, queue[i]) < degree(graph, candidate)) {
+                candidate = queue[i];
+            }
+        }
+
+        for (int i = 0; i < count; i++) {
+            level[queue[i]] = -1;
+        }
+
+        if (last_level <= depth) {
+            break;
+        }
+        depth = last_level;
+        root = candidate;
+    }
+
+    return root;
+}
+
+static int append_component(const CSRGraph* graph, int root, int* order, int filled,
+                            bool* visited, bool by_degree, long long* scratch) {
+    int head = filled;
+    int tail = filled;
+
+    order[tail++] = root;
+    visited[root] = true;
+
+    while (head < tail) {
+        int u = order[head++];
+        int first = tail;
+
+        for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            int v = graph->neighbors[e];
+            if (!visited[v]) {
+                visited[v] = true;
+                order[tail++] = v;
+            }
+        }
+
+        if (by_degree && tail - first > 1) {
+            for (int i = first; i < tail; i++) {
+                scratch[i - first] = ((long long)degree(graph, order[i]) << 32) | order[i];
+            }
+            qsort(scratch, tail - first, sizeof(long long), compare_packed);
+            for (int i = first; i < tail; i++) {
+                order[i] = (int)(scratch[i - first] & 0xffffffffLL);
+            }
+        }
+    }
+
+    return tail;
+}
+
+static void degree_order(const CSRGraph* graph, int* order) {
+    int vertices = graph->vertices;
+    int max_degree = 0;
+
+    for (int u = 0; u < vertices; u++) {
+        if (degree(graph, u) > max_degree) {
+            max_degree = degree(graph, u);
+        }
+    }
+
+    int* bucket = (int*)safe_malloc((max_degree + 2) * sizeof(int));
+    for (int d = 0; d <= max_degree + 1; d++) {
+        bucket[d] = 0;
+    }
+    for (int u = 0; u < vertices; u++) {
+        bucket[max_degree - degree(graph, u) + 1]++;
+    }
+    for (int d = 0; d <= max_degree; d++) {
+        bucket[d + 1] += bucket[d];
+    }
+    for (int u = 0; u < vertices; u++) {
+        order[bucket[max_degree - degree(graph, u)]++] = u;
+    }
+
+    safe_free((void**)&bucket);
+}
+
+int* compute_vertex_order(CSRGraph* graph, VertexOrder order_kind, int start_vertex) {
+    if (!graph) {
+        error_exit("Graph is NULL");
+    }
+
+    if (start_vertex < 0 || start_vertex >= graph->vertices) {
+        error_exit("Invalid start vertex");
+    }
+
+    int vertices = graph->vertices;
+    int* order = (int*)safe_malloc(vertices * sizeof(int));
+
+    if (order_kind == ORDER_IDENTITY) {
+        for (int u = 0; u < vertices; u++) {
+            order[u] = u;
+        }
+        return order;
+    }
+
+    if (order_kind == ORDER_DEGREE) {
+        degree_order(graph, order);
+        return order;
+    }
+
+    bool rcm = order_kind == ORDER_RCM;
+    bool* visited = (bool*)safe_malloc(vertices * sizeof(bool));
+    int* level = rcm ? (int*)safe_malloc(vertices * sizeof(int)) : NULL;
+    long long* scratch = rcm ? (long long*)safe_malloc(vertices * sizeof(long long)) : NULL;
+
+    for (int u = 0; u < vertices; u++) {
+        visited[u] = false;
+        if (level) {
+            level[u] = -1;
+        }
+    }
+
+    int filled = 0;
+    int next = 0;
+    int root = start_vertex;
+
+    while (filled < vertices) {
+        while (visited[root]) {
+            root = next++;
+        }
+
+        if (rcm) {
+            root = peripheral_vertex(graph, root, order + filled, level);
+        }
+        filled = append_component(graph, root, order, filled, visited, rcm, scratch);
+    }
+
+    if (rcm) {
+        for (int i = 0; i < vertices / 2; i++) {
+            int temp = order[i];
+            order[i] = order[vertices - 1 - i];
+            order[vertices - 1 - i] = temp;
+        }
+    }
+
+    safe_free((void**)&visited);
+    safe_free((void**)&level);
+    safe_free((void**)&scratch);
+
+    debug_print("Computed %s vertex order for %d vertices", vertex_order_name(order_kind), vertices);
+    return order;
+}
+
+int* invert_vertex_order(const int* order, int vertices) {
+    int* rank = (int*)safe_malloc(vertices * sizeof(int));
+
+    for (int i = 0; i < vertices; i++) {
+        rank[order[i]] = i;
+    }
+
+    return rank;
+}
+
+CSRGraph* permute_csr_graph(CSRGraph* graph, const int* order) {
+    if (!graph || !order) {
+        error_exit("Graph or order is NULL");
+    }
+
+    int vertices = graph->vertices;
+    int slots = 2 * graph->edges;
+    int* rank = invert_vertex_order(order, vertices);
+
+    CSRGraph* permuted = (CSRGraph*)safe_malloc(sizeof(CSRGraph));
+    permuted->vertices = vertices;
+    permuted->edges = graph->edges;
+    permuted->max_weight = graph->max_weight;
+    permuted->mapping = NULL;
+    permuted->mapping_size = 0;
+    permuted->offsets = (int*)safe_malloc((vertices + 1) * sizeof(int));
+    permuted->neighbors = (int*)safe_malloc((slots > 0 ? slots : 1) * sizeof(int));
+    permuted->weights = (int*)safe_malloc((slots > 0 ? slots : 1) * sizeof(int));
+
+    permuted->offsets[0] = 0;
+    for (int i = 0; i < vertices; i++) {
+        permuted->offsets[i + 1] = permuted->offsets[i] + degree(graph, order[i]);
+    }
+
+    int* cursor = (int*)safe_malloc(vertices * sizeof(int));
+    for (int i = 0; i < vertices; i++) {
+        cursor[i] = permuted->offsets[i];
+    }
+
+    for (int i = 0; i < vertices; i++) {
+        int u = order[i];
+        for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            int j = rank[graph->neighbors[e]];
+            permuted->neighbors[cursor[j]] = i;
+            permuted->weights[cursor[j]++] = graph->weights[e];
+        }
+    }
+
+    safe_free((void**)&cursor);
+    safe_free((void**)&rank);
+
+    return permuted;
+}
+
+MST_Result* unpermute_mst_result(MST_Result* result, const int* order) {
+    if (!result || !order) {
+        error_exit("Result or order is NULL");
+    }
+
+    int vertices = result->vertex_count;
+    MST_Result* mapped = create_mst_result(vertices);
+
+    for (int i = 0; i < vertices; i++) {
+        int u = order[i];
+        mapped->parent[u] = result->parent[i] >= 0 ? order[result->parent[i]] : -1;
+        mapped->key[u] = result->key[i];
+    }
+    mapped->total_weight = result->total_weight;
+
+    return mapped;
+}
+
+MST_Result* prim_mst_csr_reordered(CSRGraph* graph, int start_vertex, VertexOrder order_kind) {
+    int* order = compute_vertex_order(graph, order_kind, start_vertex);
+    CSRGraph* permuted = permute_csr_graph(graph, order);
+
+    int start = 0;
+    while (order[start] != start_vertex) {
+        start++;
+    }
+
+    MST_Result* local = prim_mst_csr(permuted, start);
+    MST_Result* result = unpermute_mst_result(local, order);
+
+    destroy_mst_result(local);
+    destroy_csr_graph(permuted);
+    safe_free((void**)&order);
+
+    return result;
+}
+
+const char* vertex_order_name(VertexOrder order) {
+    switch (order) {
+        case ORDER_IDENTITY:
+            return "identity";
+        case ORDER_BFS:
+            return "bfs";
+        case ORDER_RCM:
+            return "rcm";
+        case ORDER_DEGREE:
+            return "degree";
+    }
+    return "unknown";
+}
\ No newline at end of file
@@ -0,0 +1,339 @@
+#include "streaming_mst.h"
+
+typedef struct LinkCutNode {
+    int child[2];
+    int parent;
+    int max_node;
+    int weight;
+    bool flipped;
+} LinkCutNode;
+
+struct StreamingMST {
+    LinkCutNode *nodes;
+    int *stack;
+    int *edge_u;
+    int *edge_v;
+    int *free_slots;
+    int free_count;
+    int vertices;
+    int edge_count;
+    long long total_weight;
+    long long edges_seen;
+};
+
+StreamingMST* create_streaming_mst(int vertices) {
+    if (vertices <= 0) {
+        error_exit("Number of vertices must be positive");
+    }
+
+    StreamingMST* stream = (StreamingMST*)safe_malloc(sizeof(StreamingMST));
+    int slots = vertices > 1 ? vertices - 1 : 1;
+    int node_count = vertices + slots;
+
+    stream->nodes = (LinkCutNode*)safe_malloc(node_count * sizeof(LinkCutNode));
+    stream->stack = (int*)safe_malloc(node_count * sizeof(int));
+    stream->edge_u = (int*)safe_malloc(slots * sizeof(int));
+    stream->edge_v = (int*)safe_malloc(slots * sizeof(int));
+    stream->free_slots = (int*)safe_malloc(slots * sizeof(int));
+    stream->free_count = slots;
+    stream->vertices = vertices;
+    stream->edge_count = 0;
+    stream->total_weight = 0;
+    stream->edges_seen = 0;
+
+    for (int i = 0; i < node_count; i++) {
+        LinkCutNode* node = &stream->nodes[i];
+        node->child[0] = -1;
+        node->child[1] = -1;
+        node->parent = -1;
+        node->max_node = i;
+        node->weight = INT_MIN;
+        node->flipped = false;
+    }
+
+    for (int i = 0; i < slots; i++) {
+        stream->free_slots[i] = slots - 1 - i;
+        stream->edge_u[i] = -1;
+        stream->edge_v[i] = -1;
+    }
+
+    return stream;
+}
+
+static bool is_splay_root(LinkCutNode* nodes, int x) {
+    int p = nodes[x].parent;
+    return p < 0 || (nodes[p].child[0] != x && nodes[p].child[1] != x);
+}
+
+static void pull(LinkCutNode* nodes, int x) {
+    int best = x;
+
+    for (int side = 0; side < 2; side++) {
+        int c = nodes[x].child[side];
+        if (c >= 0 && nodes[nodes[c].max_node].weight > nodes[best].weight) {
+            best = nodes[c].max_node;
+        }
+    }
+
+    nodes[x].max_node = best;
+}
+
+static void push(LinkCutNode* nodes, int x) {
+    if (!nodes[x].flipped) {
+        return;
+    }
+
+    int left = nodes[x].child[0];
+    nodes[x].child[0] = nodes[x].child[1];
+    nodes[x].child[1] = left;
+
+    for (int side = 0; side < 2; side++) {
+        int c = nodes[x].child[side];
+        if (c >= 0) {
+            nodes[c].flipped = !nodes[c].flipped;
+        }
+    }
+
+    nodes[x].flipped = false;
+}
+
+static void rotate(LinkCutNode* nodes, int x) {
+    int p = nodes[x].parent;
+    int g = nodes[p].parent;
+    int dir = nodes[p].child[1] == x;
+    int moved = nodes[x].child[!dir];
+
+    if (!is_splay_root(nodes, p)) {
+        nodes[g].child[nodes[g].child[1] == p] = x;
+    }
+    nodes[x].parent = g;
+
+    nodes[x].child[!dir] = p;
+    nodes[p].parent = x;
+
+    nodes[p].child[dir] = moved;
+    if (moved >= 0) {
+        nodes[moved].parent = p;
+    }
+
+    pull(nodes, p);
+    pull(nodes, x);
+}
+
+static void splay(StreamingMST* stream, int x) {
+    LinkCutNode* nodes = stream->nodes;
+    int top = 0;
+
+    stream->stack[top++] = x;
+    for (int y = x; !is_splay_root(nodes, y); y = nodes[y].parent) {
+        stream->stack[top++] = nodes[y].parent;
+    }
+    while (top > 0) {
+        push(nodes, stream->stack[--top]);
+    }
+
+    while (!is_splay_root(nodes, x)) {
+        int p = nodes[x].parent;
+
+        if (!is_splay_root(nodes, p)) {
+            int g = nodes[p].parent;
+            bool zig_zig = (nodes[g].child[0] == p) == (nodes[p].child[0] == x);
+            rotate(nodes, zig_zig ? p : x);
+        }
+        rotate(nodes, x);
+    }
+}
+
+static void access(StreamingMST* stream, int x) {
+    LinkCutNode* nodes = stream->nodes;
+    int last = -1;
+
+    for (int y = x; y >= 0; y = nodes[y].parent) {
+        splay(stream, y);
+        nodes[y].child[1] = last;
+        pull(nodes, y);
+        last = y;
+    }
+
+    splay(stream, x);
+}
+
+static void make_root(StreamingMST* stream, int x) {
+    access(stream, x);
+    stream->nodes[x].flipped = !stream->nodes[x].flipped;
+}
+
+static int find_root(StreamingMST* stream, int x) {
+    LinkCutNode* nodes = stream->nodes;
+
+    access(stream, x);
+    while (true) {
+        push(nodes, x);
+        if (nodes[x].child[0] < 0) {
+            break;
+        }
+        x = nodes[x].child[0];
+    }
+    splay(stream, x);
+
+    return x;
+}
+
+static void link_nodes(StreamingMST* stream, int x, int y) {
+    make_root(stream, x);
+    stream->nodes[x].parent = y;
+}
+
+static void cut_nodes(StreamingMST* stream, int x, int y) {
+    LinkCutNode* nodes = stream->nodes;
+
+    make_root(stream, x);
+    access(stream, y);
+    nodes[y].child[0] = -1;
+    nodes[x].parent = -1;
+    pull(nodes, y);
+}
+
+static void attach_edge(StreamingMST* stream, int u, int v, int weight) {
+    int slot = stream->free_slots[--stream->free_count];
+    int node = stream->vertices + slot;
+
+    stream->nodes[node].weight = weight;
+    stream->nodes[node].max_node = node;
+    stream->edge_u[slot] = u;
+    stream->edge_v[slot] = v;
+
+    link_nodes(stream, u, node);
+    link_nodes(stream, node, v);
+
+    stream->edge_count++;
+    stream->total_weight += weight;
+}
+
+static void detach_edge(StreamingMST* stream, int node) {
+    int slot = node - stream->vertices;
+
+    cut_nodes(stream, stream->edge_u[slot], node);
+    cut_nodes(stream, node, stream->edge_v[slot]);
+
+    stream->total_weight -= stream->nodes[node].weight;
+    stream->edge_count--;
+    stream->nodes[node].weight = INT_MIN;
+    stream->edge_u[slot] = -1;
+    stream->edge_v[slot] = -1;
+    stream->free_slots[stream->free_count++] = slot;
+}
+
+bool streaming_mst_add_edge(StreamingMST* stream, int u, int v, int weight) {
+    if (!stream || u < 0 || v < 0 || u >= stream->vertices || v >= stream->vertices ||
+        weight < 0 || weight >= INF) {
+        return false;
+    }
+
+    stream->edges_seen++;
+    if (u == v) {
+        return false;
+    }
+
+    make_root(stream, u);
+    if (find_root(stream, v) != u) {
+        attach_edge(stream, u, v, weight);
+        return true;
+    }
+
+    access(stream, v);
+
+    int heaviest = stream->nodes[v].max_node;
+    if (stream->nodes[heaviest].weight <= weight) {
+        return false;
+    }
+
+    detach_edge(stream, heaviest);
+    attach_edge(stream, u, v, weight);
+
+    debug_print("Stream edge (%d, %d, %d) replaced a heavier forest edge", u, v, weight);
+    return true;
+}
+
+int streaming_mst_edge_count(StreamingMST* stream) {
+    return stream ? stream->edge_count : 0;
+}
+
+long long streaming_mst_weight(StreamingMST* stream) {
+    return stream ? stream->total_weight : 0;
+}
+
+long long streaming_mst_edges_seen(StreamingMST* stream) {
+    return stream ? stream->edges_seen : 0;
+}
+
+static int collect_forest_edges(StreamingMST* stream, int* src, int* dest, int* weight) {
+    int count = 0;
+    int slots = stream->vertices > 1 ? stream->vertices - 1 : 1;
+
+    for (int slot = 0; slot < slots; slot++) {
+        if (stream->edge_u[slot] >= 0) {
+            src[count] = stream->edge_u[slot];
+            dest[count] = stream->edge_v[slot];
+            weight[count] = stream->nodes[stream->vertices + slot].weight;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+MST_Result* streaming_mst_snapshot(StreamingMST* stream, int root) {
+    if (!stream) {
+        error_exit("Streaming MST is NULL");
+    }
+
+    int* src = (int*)safe_malloc(stream->vertices * sizeof(int));
+    int* dest = (int*)safe_malloc(stream->vertices * sizeof(int));
+    int* weight = (int*)safe_malloc(stream->vertices * sizeof(int));
+    int count = collect_forest_edges(stream, src, dest, weight);
+
+    MST_Result* result = NULL;
+    if (count == stream->vertices - 1) {
+        result = mst_result_from_edges(stream->vertices, root, count, src, dest, weight);
+    } else {
+        debug_print("Stream not connected yet: %d components (use streaming_msf_snapshot)",
+                   stream->vertices - count);
+    }
+
+    safe_free((void**)&src);
+    safe_free((void**)&dest);
+    safe_free((void**)&weight);
+    return result;
+}
+
+MST_Forest* streaming_msf_snapshot(StreamingMST* stream, int root) {
+    if (!stream) {
+        error_exit("Streaming MST is NULL");
+    }
+
+    int* src = (int*)safe_malloc(stream->vertices * sizeof(int));
+    int* dest = (int*)safe_malloc(stream->vertices * sizeof(int));
+    int* weight = (int*)safe_malloc(stream->vertices * sizeof(int));
+    int count = collect_forest_edges(stream, src, dest, weight);
+
+    MST_Forest* forest = mst_forest_from_edges(stream->vertices, root, count, src, dest, weight);
+
+    safe_free((void**)&src);
+    safe_free((void**)&dest);
+    safe_free((void**)&weight);
+    return forest;
+}
+
+void destroy_streaming_mst(StreamingMST* stream) {
+    if (!stream) {
+        return;
+    }
+
+    safe_free((void**)&stream->nodes);
+    safe_free((void**)&stream->stack);
+    safe_free((void**)&stream->edge_u);
+    safe_free((void**)&stream->edge_v);
+    safe_free((void**)&stream->free_slots);
+    safe_free((void**)&stream);
+}
\ No newline at end of file
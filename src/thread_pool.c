@@ -0,0 +1,183 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "thread_pool.h"
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#define BARRIER_SPIN_LIMIT 4096
+
+typedef struct ThreadWorker {
+    ThreadPool *pool;
+    int id;
+    int sense;
+} ThreadWorker;
+
+struct ThreadPool {
+    int thread_count;
+    pthread_t *threads;
+    ThreadWorker *workers;
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t work_done;
+    ThreadTask task;
+    void *arg;
+    unsigned long generation;
+    int pending;
+    bool shutdown;
+    int barrier_count;
+    int barrier_sense;
+};
+
+static void* worker_main(void* arg) {
+    ThreadWorker* worker = (ThreadWorker*)arg;
+    ThreadPool* pool = worker->pool;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    while (true) {
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+
+        if (pool->shutdown) {
+            break;
+        }
+
+        seen = pool->generation;
+        ThreadTask task = pool->task;
+        void* task_arg = pool->arg;
+        pthread_mutex_unlock(&pool->lock);
+
+        task(task_arg, worker->id, pool->thread_count);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->work_done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+int thread_pool_default_size(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (int)cpus : 1;
+}
+
+ThreadPool* create_thread_pool(int thread_count) {
+    if (thread_count <= 0) {
+        thread_count = thread_pool_default_size();
+    }
+
+    ThreadPool* pool = (ThreadPool*)safe_malloc(sizeof(ThreadPool));
+    pool->thread_count = thread_count;
+    pool->task = NULL;
+    pool->arg = NULL;
+    pool->generation = 0;
+    pool->pending = 0;
+    pool->shutdown = false;
+    pool->barrier_count = 0;
+    pool->barrier_sense = 0;
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+
+    pool->threads = (pthread_t*)safe_malloc(thread_count * sizeof(pthread_t));
+    pool->workers = (ThreadWorker*)safe_malloc(thread_count * sizeof(ThreadWorker));
+
+    for (int i = 0; i < thread_count; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].id = i;
+        pool->workers[i].sense = 0;
+    }
+
+    for (int i = 1; i < thread_count; i++) {
+        if (pthread_create(&pool->threads[i], NULL, worker_main, &pool->workers[i]) != 0) {
+            error_exit("Failed to create worker thread");
+        }
+    }
+
+    debug_print("Created thread pool with %d threads", thread_count);
+    return pool;
+}
+
+int thread_pool_size(ThreadPool* pool) {
+    return pool ? pool->thread_count : 1;
+}
+
+void thread_pool_run(ThreadPool* pool, ThreadTask task, void* arg) {
+    if (!pool) {
+        error_exit("Thread pool is NULL");
+    }
+
+    if (pool->thread_count == 1) {
+        task(arg, 0, 1);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->arg = arg;
+    pool->pending = pool->thread_count - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    task(arg, 0, pool->thread_count);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void thread_pool_barrier(ThreadPool* pool, int thread_id) {
+    if (pool->thread_count == 1) {
+        return;
+    }
+
+    int sense = !pool->workers[thread_id].sense;
+    pool->workers[thread_id].sense = sense;
+
+    if (__atomic_add_fetch(&pool->barrier_count, 1, __ATOMIC_ACQ_REL) == pool->thread_count) {
+        __atomic_store_n(&pool->barrier_count, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pool->barrier_sense, sense, __ATOMIC_RELEASE);
+        return;
+    }
+
+    int spins = 0;
+    while (__atomic_load_n(&pool->barrier_sense, __ATOMIC_ACQUIRE) != sense) {
+        if (++spins > BARRIER_SPIN_LIMIT) {
+            sched_yield();
+        }
+    }
+}
+
+void destroy_thread_pool(ThreadPool* pool) {
+    if (!pool) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 1; i < pool->thread_count; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_cond_destroy(&pool->work_done);
+
+    safe_free((void**)&pool->threads);
+    safe_free((void**)&pool->workers);
+
+    debug_print("Destroyed thread pool with %d threads", pool->thread_count);
+    safe_free((void**)&pool);
+}
\ No newline at end of file
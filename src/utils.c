@@ -1,3 +1,5 @@
+#define _POSIX_C_SOURCE 200112L
+
 #include "utils.h"
 
 void* safe_malloc(size_t size) {
@@ -8,6 +10,22 @@ void* safe_malloc(size_t size) {
     return ptr;
 }
 
+void* safe_aligned_malloc(size_t alignment, size_t size) {
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, alignment, size) != 0) {
+        error_exit("Memory allocation failed");
+    }
+    return ptr;
+}
+
+void* safe_realloc(void* ptr, size_t size) {
+    void *resized = realloc(ptr, size);
+    if (resized == NULL) {
+        error_exit("Memory allocation failed");
+    }
+    return resized;
+}
+
 void safe_free(void **ptr) {
     if (ptr && *ptr) {
         free(*ptr);
@@ -20,15 +38,11 @@ void error_exit(const char* message) {
     exit(EXIT_FAILURE);
 }
 
-void debug_print(const char* format, ...) {
-    #ifdef DEBUG
+void debug_trace(const char* format, ...) {
     va_list args;
     va_start(args, format);
     printf("DEBUG: ");
     vprintf(format, args);
     printf("\n");
     va_end(args);
-    #else
-    (void)format;
-    #endif
 }
\ No newline at end of file
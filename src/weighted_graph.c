@@ -0,0 +1,349 @@
+#include "weighted_graph.h"
+
+#define DEFINE_WEIGHTED_GRAPH(S, T, A) \
+    static bool valid_weight_##S(T weight) { \
+        return weight < WEIGHT_NONE_##S; \
+    } \
+    \
+    Graph_##S* create_graph_##S(int vertices) { \
+        if (vertices <= 0) { \
+            error_exit("Number of vertices must be positive"); \
+        } \
+    \
+        int lanes = CACHE_LINE_SIZE / (int)sizeof(T); \
+        if (vertices > INT_MAX - lanes) { \
+            error_exit("Too many vertices"); \
+        } \
+    \
+        Graph_##S* graph = (Graph_##S*)safe_malloc(sizeof(Graph_##S)); \
+        graph->vertices = vertices; \
+        graph->stride = (vertices + lanes - 1) / lanes * lanes; \
+        graph->max_weight = 0; \
+        graph->matrix = (T*)safe_aligned_malloc(CACHE_LINE_SIZE, \
+                                                (size_t)vertices * graph->stride * sizeof(T)); \
+    \
+        size_t cells = (size_t)vertices * graph->stride; \
+        for (size_t i = 0; i < cells; i++) { \
+            graph->matrix[i] = WEIGHT_NONE_##S; \
+        } \
+        for (int i = 0; i < vertices; i++) { \
+            graph_row_##S(graph, i)[i] = 0; \
+        } \
+    \
+        debug_print("Created " #S " graph with %d vertices", vertices); \
+        return graph; \
+    } \
+    \
+    bool add_edge_##S(Graph_##S* graph, int src, int dest, T weight) { \
+        if (!graph) { \
+            error_exit("Graph is NULL"); \
+        } \
+    \
+        if (src < 0 || src >= graph->vertices || dest < 0 || dest >= graph->vertices) { \
+            debug_print("Invalid vertex indices: %d -- %d", src, dest); \
+            return false; \
+        } \
+    \
+        if (!valid_weight_##S(weight)) { \
+            debug_print("Weight of %d -- %d is not below the " #S " no-edge sentinel", src, dest); \
+            return false; \
+        } \
+    \
+        if (src == dest) { \
+            debug_print("Self-loop ignored: vertex %d", src); \
+            return true; \
+        } \
+    \
+        graph_row_##S(graph, src)[dest] = weight; \
+        graph_row_##S(graph, dest)[src] = weight; \
+    \
+        if (weight > graph->max_weight) { \
+            graph->max_weight = weight; \
+        } \
+        return true; \
+    } \
+    \
+    void destroy_graph_##S(Graph_##S* graph) { \
+        if (!graph) { \
+            return; \
+        } \
+    \
+        safe_free((void**)&graph->matrix); \
+        safe_free((void**)&graph); \
+    } \
+    \
+    CSRGraph_##S* create_csr_graph_##S(int vertices, int edge_count, const int* src, \
+                                       const int* dest, const T* weight) { \
+        if (vertices <= 0) { \
+            error_exit("Number of vertices must be positive"); \
+        } \
+    \
+        if (edge_count < 0 || edge_count > INT_MAX / 2) { \
+            error_exit("Invalid number of edges"); \
+        } \
+    \
+        if (edge_count > 0 && (!src || !dest || !weight)) { \
+            error_exit("Edge arrays are NULL"); \
+        } \
+    \
+        CSRGraph_##S* graph = (CSRGraph_##S*)safe_malloc(sizeof(CSRGraph_##S)); \
+        graph->vertices = vertices; \
+        graph->edges = 0; \
+        graph->offsets = (int*)safe_malloc((vertices + 1) * sizeof(int)); \
+    \
+        for (int i = 0; i <= vertices; i++) { \
+            graph->offsets[i] = 0; \
+        } \
+    \
+        for (int i = 0; i < edge_count; i++) { \
+            if (src[i] < 0 || src[i] >= vertices || dest[i] < 0 || dest[i] >= vertices || \
+                !valid_weight_##S(weight[i])) { \
+                debug_print("Invalid " #S " edge %d: %d -- %d", i, src[i], dest[i]); \
+                safe_free((void**)&graph->offsets); \
+                safe_free((void**)&graph); \
+                return NULL; \
+            } \
+    \
+            if (src[i] != dest[i]) { \
+                graph->offsets[src[i] + 1]++; \
+                graph->offsets[dest[i] + 1]++; \
+                graph->edges++; \
+            } \
+        } \
+    \
+        for (int i = 0; i < vertices; i++) { \
+            graph->offsets[i + 1] += graph->offsets[i]; \
+        } \
+    \
+        int slots = graph->edges > 0 ? 2 * graph->edges : 1; \
+        graph->neighbors = (int*)safe_malloc(slots * sizeof(int)); \
+        graph->weights = (T*)safe_malloc(slots * sizeof(T)); \
+    \
+        int* cursor = (int*)safe_malloc(vertices * sizeof(int)); \
+        for (int i = 0; i < vertices; i++) { \
+            cursor[i] = graph->offsets[i]; \
+        } \
+    \
+        for (int i = 0; i < edge_count; i++) { \
+            if (src[i] == dest[i]) { \
+                continue; \
+            } \
+    \
+            graph->neighbors[cursor[src[i]]] = dest[i]; \
+            graph->weights[cursor[src[i]]++] = weight[i]; \
+            graph->neighbors[cursor[dest[i]]] = src[i]; \
+            graph->weights[cursor[dest[i]]++] = weight[i]; \
+        } \
+    \
+        safe_free((void**)&cursor); \
+    \
+        debug_print("Created " #S " CSR graph with %d vertices and %d edges", vertices, graph->edges); \
+        return graph; \
+    } \
+    \
+    void destroy_csr_graph_##S(CSRGraph_##S* graph) { \
+        if (!graph) { \
+            return; \
+        } \
+    \
+        safe_free((void**)&graph->offsets); \
+        safe_free((void**)&graph->neighbors); \
+        safe_free((void**)&graph->weights); \
+        safe_free((void**)&graph); \
+    } \
+    \
+    static MST_Result_##S* create_mst_result_##S(int vertices) { \
+        MST_Result_##S* result = (MST_Result_##S*)safe_malloc(sizeof(MST_Result_##S)); \
+    \
+        result->parent = (int*)safe_malloc(vertices * sizeof(int)); \
+        result->key = (T*)safe_malloc(vertices * sizeof(T)); \
+        result->total_weight = 0; \
+        result->vertex_count = vertices; \
+    \
+        for (int i = 0; i < vertices; i++) { \
+            result->parent[i] = -1; \
+            result->key[i] = WEIGHT_NONE_##S; \
+        } \
+    \
+        return result; \
+    } \
+    \
+    MST_Result_##S* prim_mst_##S(Graph_##S* graph, int start_vertex) { \
+        if (!graph) { \
+            error_exit("Graph is NULL"); \
+        } \
+    \
+        if (start_vertex < 0 || start_vertex >= graph->vertices) { \
+            error_exit("Invalid start vertex"); \
+        } \
+    \
+        int vertices = graph->vertices; \
+        MST_Result_##S* result = create_mst_result_##S(vertices); \
+        T* key = result->key; \
+    \
+        bool* in_mst = (bool*)safe_malloc(vertices * sizeof(bool)); \
+        for (int i = 0; i < vertices; i++) { \
+            in_mst[i] = false; \
+        } \
+    \
+        key[start_vertex] = 0; \
+        int u = start_vertex; \
+    \
+        for (int count = 1; count <= vertices; count++) { \
+            in_mst[u] = true; \
+            if (u != start_vertex) { \
+                result->total_weight += (A)key[u]; \
+            } \
+    \
+            const T* row = graph_row_##S(graph, u); \
+            T min_key = WEIGHT_NONE_##S; \
+            int next = -1; \
+    \
+            for (int v = 0; v < vertices; v++) { \
+                if (in_mst[v]) { \
+                    continue; \
+                } \
+                if (row[v] < key[v]) { \
+                    key[v] = row[v]; \
+                    result->parent[v] = u; \
+                } \
+                if (key[v] < min_key) { \
+                    min_key = key[v]; \
+                    next = v; \
+                } \
+            } \
+    \
+            if (next == -1 && count < vertices) { \
+                error_exit("Graph is not connected"); \
+            } \
+            u = next; \
+        } \
+    \
+        safe_free((void**)&in_mst); \
+        return result; \
+    } \
+    \
+    static void heap_sift_up_##S(int* heap, int* pos, const T* key, int index) { \
+        int vertex = heap[index]; \
+    \
+        while (index > 0) { \
+            int parent = (index - 1) / 2; \
+            if (!(key[vertex] < key[heap[parent]])) { \
+                break; \
+            } \
+            heap[index] = heap[parent]; \
+            pos[heap[index]] = index; \
+            index = parent; \
+        } \
+    \
+        heap[index] = vertex; \
+        pos[vertex] = index; \
+    } \
+    \
+    static void heap_sift_down_##S(int* heap, int* pos, const T* key, int size, int index) { \
+        int vertex = heap[index]; \
+    \
+        while (true) { \
+            int child = 2 * index + 1; \
+            if (child >= size) { \
+                break; \
+            } \
+            if (child + 1 < size && key[heap[child + 1]] < key[heap[child]]) { \
+                child++; \
+            } \
+            if (!(key[heap[child]] < key[vertex])) { \
+                break; \
+            } \
+            heap[index] = heap[child]; \
+            pos[heap[index]] = index; \
+            index = child; \
+        } \
+    \
+        heap[index] = vertex; \
+        pos[vertex] = index; \
+    } \
+    \
+    MST_Result_##S* prim_mst_csr_##S(CSRGraph_##S* graph, int start_vertex) { \
+        if (!graph) { \
+            error_exit("Graph is NULL"); \
+        } \
+    \
+        if (start_vertex < 0 || start_vertex >= graph->vertices) { \
+            error_exit("Invalid start vertex"); \
+        } \
+    \
+        int vertices = graph->vertices; \
+        MST_Result_##S* result = create_mst_result_##S(vertices); \
+        T* key = result->key; \
+    \
+        int* heap = (int*)safe_malloc(vertices * sizeof(int)); \
+        int* pos = (int*)safe_malloc(vertices * sizeof(int)); \
+        bool* in_mst = (bool*)safe_malloc(vertices * sizeof(bool)); \
+        for (int i = 0; i < vertices; i++) { \
+            pos[i] = -1; \
+            in_mst[i] = false; \
+        } \
+    \
+        int size = 0; \
+        int visited = 0; \
+        key[start_vertex] = 0; \
+        heap[size++] = start_vertex; \
+        pos[start_vertex] = 0; \
+    \
+        while (size > 0) { \
+            int u = heap[0]; \
+            pos[u] = -1; \
+            if (--size > 0) { \
+                heap[0] = heap[size]; \
+                heap_sift_down_##S(heap, pos, key, size, 0); \
+            } \
+    \
+            in_mst[u] = true; \
+            visited++; \
+            if (u != start_vertex) { \
+                result->total_weight += (A)key[u]; \
+            } \
+    \
+            for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) { \
+                int v = graph->neighbors[e]; \
+                T weight = graph->weights[e]; \
+    \
+                if (in_mst[v] || !(weight < key[v])) { \
+                    continue; \
+                } \
+    \
+                key[v] = weight; \
+                result->parent[v] = u; \
+    \
+                if (pos[v] < 0) { \
+                    heap[size] = v; \
+                    heap_sift_up_##S(heap, pos, key, size); \
+                    size++; \
+                } else { \
+                    heap_sift_up_##S(heap, pos, key, pos[v]); \
+                } \
+            } \
+        } \
+    \
+        safe_free((void**)&heap); \
+        safe_free((void**)&pos); \
+        safe_free((void**)&in_mst); \
+    \
+        if (visited != vertices) { \
+            error_exit("Graph is not connected"); \
+        } \
+    \
+        return result; \
+    } \
+    \
+    void destroy_mst_result_##S(MST_Result_##S* result) { \
+        if (!result) { \
+            return; \
+        } \
+    \
+        safe_free((void**)&result->parent); \
+        safe_free((void**)&result->key); \
+        safe_free((void**)&result); \
+    }
+
+WEIGHT_TYPES(DEFINE_WEIGHTED_GRAPH)
\ No newline at end of file
@@ -1,5 +1,24 @@
 #include "../include/prim.h"
+#include "../include/prim_dense.h"
+#include "../include/boruvka.h"
+#include "../include/thread_pool.h"
+#include "../include/graph_io.h"
+#include "../include/generator.h"
+#include "../include/dynamic_mst.h"
+#include "../include/mst_workspace.h"
+#include "../include/mst_batch.h"
+#include "../include/weighted_graph.h"
+#include "../include/euclidean_mst.h"
+#include "../include/external_mst.h"
+#include "../include/streaming_mst.h"
+#include "../include/instrument.h"
+#include "../include/reorder.h"
+#include "../include/kruskal.h"
+#include "../include/mst_select.h"
+#include "../include/mst_verify.h"
+#include "../include/mst_query.h"
 #include <assert.h>
+#include <string.h>
 
 void test_utils() {
     printf("Testing utility functions...\n");
@@ -34,6 +53,32 @@ void test_graph_creation() {
     printf("✓ Graph creation test passed\n");
 }
 
+void test_graph_layout() {
+    printf("Testing contiguous graph layout...\n");
+
+    Graph* graph = create_graph(37);
+    assert(graph->stride >= graph->vertices);
+    assert((graph->stride * sizeof(int)) % CACHE_LINE_SIZE == 0);
+    assert(((size_t)graph->matrix % CACHE_LINE_SIZE) == 0);
+
+    for (int i = 0; i < graph->vertices; i++) {
+        assert(graph->adj_matrix[i] == graph_row(graph, i));
+        assert(((size_t)graph_row(graph, i) % CACHE_LINE_SIZE) == 0);
+        for (int j = graph->vertices; j < graph->stride; j++) {
+            assert(graph_row(graph, i)[j] == INF);
+        }
+    }
+
+    add_edge(graph, 3, 36, 12);
+    assert(graph_weight(graph, 3, 36) == 12);
+    assert(graph_weight(graph, 36, 3) == 12);
+    assert(graph->adj_matrix[36][3] == 12);
+    assert(graph_weight(graph, 5, 5) == 0);
+
+    destroy_graph(graph);
+    printf("✓ Contiguous graph layout test passed\n");
+}
+
 void test_graph_edges() {
     printf("Testing graph edge operations...\n");
 
@@ -90,6 +135,181 @@ void test_priority_queue() {
     printf("✓ Priority queue test passed\n");
 }
 
+void test_pq_backends() {
+    printf("Testing priority queue backends...\n");
+
+    PQBackend backends[] = {PQ_BINARY_HEAP, PQ_DARY4_HEAP, PQ_DARY8_HEAP, PQ_PAIRING_HEAP};
+    const int size = 300;
+
+    for (int b = 0; b < 4; b++) {
+        PriorityQueue* pq = create_pq_backend(size, backends[b]);
+        assert(pq->backend == backends[b]);
+        assert(is_empty_pq(pq) == true);
+
+        srand(3 + b);
+        for (int v = 0; v < size; v++) {
+            insert_pq(pq, v, rand() % 1000);
+        }
+
+        for (int i = 0; i < size / 3; i++) {
+            assert(extract_min(pq) >= 0);
+        }
+
+        for (int i = 0; i < size; i++) {
+            int v = rand() % size;
+            if (is_in_pq(pq, v) && pq->key[v] > 0) {
+                decrease_key(pq, v, rand() % pq->key[v]);
+            }
+        }
+
+        int last_key = -1;
+        int extracted = size / 3;
+        while (!is_empty_pq(pq)) {
+            int v = extract_min(pq);
+            assert(pq->key[v] >= last_key);
+            assert(is_in_pq(pq, v) == false);
+            last_key = pq->key[v];
+            extracted++;
+        }
+        assert(extracted == size);
+
+        destroy_pq(pq);
+    }
+
+    Graph* graph = create_graph(40);
+    srand(19);
+    for (int i = 1; i < 40; i++) {
+        add_edge(graph, i, rand() % i, (rand() % 50) + 1);
+        add_edge(graph, rand() % 40, rand() % 40, (rand() % 50) + 1);
+    }
+    CSRGraph* csr = csr_from_graph(graph);
+    MST_Result* expected = prim_mst_simple(graph, 0);
+
+    for (int b = 0; b < 4; b++) {
+        MST_Result* dense_result = prim_mst_with_pq(graph, 0, backends[b]);
+        MST_Result* csr_result = prim_mst_csr_with_pq(csr, 0, backends[b]);
+        assert(dense_result->total_weight == expected->total_weight);
+        assert(csr_result->total_weight == expected->total_weight);
+        assert(validate_mst(graph, dense_result) == true);
+        assert(validate_mst_csr(csr, csr_result) == true);
+        destroy_mst_result(dense_result);
+        destroy_mst_result(csr_result);
+    }
+
+    destroy_mst_result(expected);
+    destroy_csr_graph(csr);
+    destroy_graph(graph);
+    printf("✓ Priority queue backends test passed\n");
+}
+
+void test_bucket_queue() {
+    printf("Testing bucket priority queue...\n");
+
+    PriorityQueue* pq = create_pq_bounded(6, PQ_BUCKET_QUEUE, 4095);
+    insert_pq(pq, 0, 4095);
+    insert_pq(pq, 1, 64);
+    insert_pq(pq, 2, INF);
+    insert_pq(pq, 3, 64);
+    insert_pq(pq, 4, 0);
+    insert_pq(pq, 5, 4000);
+
+    assert(extract_min(pq) == 4);
+    decrease_key(pq, 2, 3);
+    decrease_key(pq, 0, 63);
+    assert(extract_min(pq) == 2);
+    assert(extract_min(pq) == 0);
+
+    int next = extract_min(pq);
+    assert(next == 1 || next == 3);
+    next = extract_min(pq);
+    assert(next == 1 || next == 3);
+    assert(extract_min(pq) == 5);
+    assert(is_empty_pq(pq) == true);
+    destroy_pq(pq);
+
+    assert(pq_select_backend(4095) == PQ_BUCKET_QUEUE);
+    assert(pq_select_backend(PQ_BUCKET_THRESHOLD) == PQ_DEFAULT_BACKEND);
+
+    const int vertices = 200;
+    Graph* graph = create_graph(vertices);
+    srand(23);
+    for (int i = 1; i < vertices; i++) {
+        add_edge(graph, i, rand() % i, rand() % 4096);
+    }
+    for (int i = 0; i < vertices * 4; i++) {
+        add_edge(graph, rand() % vertices, rand() % vertices, rand() % 4096);
+    }
+    assert(graph->max_weight < 4096);
+
+    CSRGraph* csr = csr_from_graph(graph);
+    assert(csr->max_weight <= graph->max_weight);
+
+    MST_Result* expected = prim_mst_with_pq(graph, 0, PQ_BINARY_HEAP);
+    MST_Result* dense_result = prim_mst(graph, 0);
+    MST_Result* csr_result = prim_mst_csr_with_pq(csr, 0, PQ_BUCKET_QUEUE);
+
+    assert(dense_result->total_weight == expected->total_weight);
+    assert(csr_result->total_weight == expected->total_weight);
+    assert(validate_mst_csr(csr, csr_result) == true);
+
+    destroy_mst_result(expected);
+    destroy_mst_result(dense_result);
+    destroy_mst_result(csr_result);
+    destroy_csr_graph(csr);
+    destroy_graph(graph);
+    printf("✓ Bucket priority queue test passed\n");
+}
+
+void test_pq_error_codes() {
+    printf("Testing priority queue error codes...\n");
+
+    assert(create_pq_bounded(0, PQ_BINARY_HEAP, -1) == NULL);
+    assert(create_pq_bounded(8, PQ_BUCKET_QUEUE, -1) == NULL);
+    assert(create_pq_bounded(8, PQ_BUCKET_QUEUE, INF) == NULL);
+
+    assert(insert_pq(NULL, 0, 1) == PQ_ERR_NULL);
+    assert(decrease_key(NULL, 0, 1) == PQ_ERR_NULL);
+    assert(extract_min(NULL) == -1);
+
+    PQBackend backends[] = {PQ_BINARY_HEAP, PQ_DARY4_HEAP, PQ_DARY8_HEAP,
+                            PQ_PAIRING_HEAP, PQ_BUCKET_QUEUE};
+
+    for (int b = 0; b < 5; b++) {
+        PriorityQueue* pq = create_pq_bounded(3, backends[b], 100);
+        assert(pq != NULL);
+
+        assert(extract_min(pq) == -1);
+        assert(insert_pq(pq, -1, 5) == PQ_ERR_RANGE);
+        assert(insert_pq(pq, 3, 5) == PQ_ERR_RANGE);
+        assert(insert_pq(pq, 0, 50) == PQ_OK);
+        assert(insert_pq(pq, 0, 40) == PQ_ERR_PRESENT);
+        assert(insert_pq(pq, 1, 60) == PQ_OK);
+        assert(decrease_key(pq, 2, 10) == PQ_ERR_ABSENT);
+        assert(decrease_key(pq, 1, 70) == PQ_ERR_KEY);
+        assert(decrease_key(pq, 7, 10) == PQ_ERR_RANGE);
+        assert(decrease_key(pq, 1, 20) == PQ_OK);
+        assert(insert_pq(pq, 2, INF) == PQ_OK);
+        assert(insert_pq(pq, 2, 1) == PQ_ERR_FULL);
+
+        if (backends[b] == PQ_BUCKET_QUEUE) {
+            assert(decrease_key(pq, 2, -1) == PQ_ERR_KEY);
+        }
+
+        assert(extract_min(pq) == 1);
+        assert(extract_min(pq) == 0);
+        assert(extract_min(pq) == 2);
+        assert(extract_min(pq) == -1);
+        assert(is_empty_pq(pq));
+
+        destroy_pq(pq);
+    }
+
+    assert(strcmp(pq_status_name(PQ_OK), "ok") == 0);
+    assert(strcmp(pq_status_name(PQ_ERR_ABSENT), "vertex not in queue") == 0);
+
+    printf("✓ Priority queue error code test passed\n");
+}
+
 void test_simple_mst() {
     printf("Testing simple MST case...\n");
 
@@ -105,7 +325,7 @@ void test_simple_mst() {
     assert(result->total_weight == 19);
     assert(validate_mst(graph, result) == true);
 
-    printf("Expected total weight: 19, Actual: %d\n", result->total_weight);
+    printf("Expected total weight: 19, Actual: %lld\n", result->total_weight);
 
     destroy_mst_result(result);
     destroy_graph(graph);
@@ -133,7 +353,7 @@ void test_algorithm_comparison() {
     assert(validate_mst(graph, heap_result) == true);
     assert(validate_mst(graph, simple_result) == true);
 
-    printf("Both algorithms found MST with weight: %d\n", heap_result->total_weight);
+    printf("Both algorithms found MST with weight: %lld\n", heap_result->total_weight);
 
     destroy_mst_result(heap_result);
     destroy_mst_result(simple_result);
@@ -141,6 +361,1706 @@ void test_algorithm_comparison() {
     printf("✓ Algorithm comparison test passed\n");
 }
 
+void test_csr_graph() {
+    printf("Testing CSR graph construction...\n");
+
+    int src[] = {0, 0, 0, 1, 2, 3};
+    int dest[] = {1, 2, 3, 3, 3, 3};
+    int weight[] = {10, 6, 5, 15, 4, 7};
+
+    CSRGraph* graph = create_csr_graph(4, 6, src, dest, weight);
+    assert(graph != NULL);
+    assert(graph->vertices == 4);
+    assert(graph->edges == 5);
+    assert(graph->offsets[0] == 0);
+    assert(graph->offsets[4] == 10);
+
+    assert(csr_edge_weight(graph, 0, 1) == 10);
+    assert(csr_edge_weight(graph, 1, 0) == 10);
+    assert(csr_edge_weight(graph, 3, 2) == 4);
+    assert(csr_edge_weight(graph, 1, 2) == INF);
+    assert(csr_edge_weight(graph, 2, 2) == 0);
+
+    destroy_csr_graph(graph);
+
+    Graph* dense = create_graph(4);
+    add_edge(dense, 0, 1, 10);
+    add_edge(dense, 2, 3, 4);
+
+    CSRGraph* converted = csr_from_graph(dense);
+    assert(converted->edges == 2);
+    assert(csr_edge_weight(converted, 1, 0) == 10);
+    assert(csr_edge_weight(converted, 2, 3) == 4);
+    assert(csr_edge_weight(converted, 0, 3) == INF);
+
+    destroy_csr_graph(converted);
+    destroy_graph(dense);
+    printf("✓ CSR graph construction test passed\n");
+}
+
+void test_csr_mst() {
+    printf("Testing CSR-based MST...\n");
+
+    const int vertices = 60;
+    Graph* graph = create_graph(vertices);
+
+    srand(7);
+    for (int i = 1; i < vertices; i++) {
+        add_edge(graph, i, rand() % i, (rand() % 100) + 1);
+    }
+    for (int i = 0; i < vertices * 3; i++) {
+        add_edge(graph, rand() % vertices, rand() % vertices, (rand() % 100) + 1);
+    }
+
+    CSRGraph* csr = csr_from_graph(graph);
+
+    MST_Result* dense_result = prim_mst(graph, 0);
+    MST_Result* csr_result = prim_mst_csr(csr, 0);
+
+    assert(csr_result->total_weight == dense_result->total_weight);
+    assert(validate_mst(graph, csr_result) == true);
+    assert(validate_mst_csr(csr, csr_result) == true);
+
+    MST_Result* other_start = prim_mst_csr(csr, vertices - 1);
+    assert(other_start->total_weight == dense_result->total_weight);
+
+    printf("CSR MST weight: %lld\n", csr_result->total_weight);
+
+    destroy_mst_result(dense_result);
+    destroy_mst_result(csr_result);
+    destroy_mst_result(other_start);
+    destroy_csr_graph(csr);
+    destroy_graph(graph);
+    printf("✓ CSR-based MST test passed\n");
+}
+
+void test_dense_kernels() {
+    printf("Testing vectorized dense Prim kernels...\n");
+
+    const int vertices = 77;
+    Graph* graph = create_graph(vertices);
+
+    srand(11);
+    for (int i = 0; i < vertices; i++) {
+        for (int j = i + 1; j < vertices; j++) {
+            if (rand() % 4 != 0) {
+                add_edge(graph, i, j, (rand() % 30) + 1);
+            }
+        }
+    }
+
+    MST_Result* expected = prim_mst_simple(graph, 5);
+    DenseKernel kernels[] = {DENSE_KERNEL_SCALAR, DENSE_KERNEL_SSE2, DENSE_KERNEL_AVX2, DENSE_KERNEL_AUTO};
+
+    for (int k = 0; k < 4; k++) {
+        if (!dense_kernel_supported(kernels[k])) {
+            printf("Kernel %s not supported, skipping\n", dense_kernel_name(kernels[k]));
+            continue;
+        }
+
+        MST_Result* result = prim_mst_dense_kernel(graph, 5, kernels[k]);
+        assert(result->total_weight == expected->total_weight);
+        assert(validate_mst(graph, result) == true);
+        for (int v = 0; v < vertices; v++) {
+            assert(result->parent[v] == expected->parent[v]);
+            assert(result->key[v] == expected->key[v]);
+        }
+        destroy_mst_result(result);
+    }
+
+    printf("Dense MST weight: %lld (detected kernel: %s)\n",
+           expected->total_weight, dense_kernel_name(dense_kernel_detect()));
+
+    destroy_mst_result(expected);
+    destroy_graph(graph);
+    printf("✓ Vectorized dense Prim kernels test passed\n");
+}
+
+static void sum_task(void* arg, int thread_id, int thread_count) {
+    int* values = (int*)arg;
+    int begin, end;
+    thread_chunk(1000, thread_id, thread_count, &begin, &end);
+
+    int sum = 0;
+    for (int i = begin; i < end; i++) {
+        sum += i;
+    }
+    __atomic_fetch_add(&values[0], sum, __ATOMIC_RELAXED);
+}
+
+void test_thread_pool() {
+    printf("Testing thread pool...\n");
+
+    ThreadPool* pool = create_thread_pool(4);
+    assert(thread_pool_size(pool) == 4);
+
+    for (int run = 0; run < 10; run++) {
+        int values[1] = {0};
+        thread_pool_run(pool, sum_task, values);
+        assert(values[0] == 999 * 1000 / 2);
+    }
+
+    destroy_thread_pool(pool);
+    printf("✓ Thread pool test passed\n");
+}
+
+void test_boruvka_mst() {
+    printf("Testing parallel Boruvka MST...\n");
+
+    const int vertices = 3000;
+    const int edges = vertices * 4;
+    int* src = (int*)safe_malloc(edges * sizeof(int));
+    int* dest = (int*)safe_malloc(edges * sizeof(int));
+    int* weight = (int*)safe_malloc(edges * sizeof(int));
+
+    srand(29);
+    for (int i = 0; i < edges; i++) {
+        src[i] = (i < vertices - 1) ? i + 1 : rand() % vertices;
+        dest[i] = (i < vertices - 1) ? rand() % (i + 1) : rand() % vertices;
+        weight[i] = rand() % 20;
+    }
+
+    CSRGraph* graph = create_csr_graph(vertices, edges, src, dest, weight);
+    MST_Result* expected = prim_mst_csr(graph, 0);
+
+    int thread_counts[] = {1, 2, 4, 0};
+    for (int t = 0; t < 4; t++) {
+        MST_Result* result = boruvka_mst(graph, 0, thread_counts[t]);
+        assert(result->total_weight == expected->total_weight);
+        assert(result->parent[0] == -1);
+        assert(validate_mst_csr(graph, result) == true);
+        destroy_mst_result(result);
+    }
+
+    printf("Boruvka MST weight: %lld\n", expected->total_weight);
+
+    destroy_mst_result(expected);
+    destroy_csr_graph(graph);
+    safe_free((void**)&src);
+    safe_free((void**)&dest);
+    safe_free((void**)&weight);
+    printf("✓ Parallel Boruvka MST test passed\n");
+}
+
+void test_dense_parallel() {
+    printf("Testing multithreaded dense Prim...\n");
+
+    const int vertices = 150;
+    Graph* graph = create_graph(vertices);
+
+    srand(31);
+    for (int i = 0; i < vertices; i++) {
+        for (int j = i + 1; j < vertices; j++) {
+            add_edge(graph, i, j, (rand() % 40) + 1);
+        }
+    }
+
+    MST_Result* expected = prim_mst_simple(graph, 9);
+
+    int thread_counts[] = {1, 2, 3, 4};
+    for (int t = 0; t < 4; t++) {
+        MST_Result* result = prim_mst_dense_parallel(graph, 9, thread_counts[t]);
+        assert(result->total_weight == expected->total_weight);
+        for (int v = 0; v < vertices; v++) {
+            assert(result->parent[v] == expected->parent[v]);
+            assert(result->key[v] == expected->key[v]);
+        }
+        destroy_mst_result(result);
+    }
+
+    destroy_mst_result(expected);
+    destroy_graph(graph);
+    printf("✓ Multithreaded dense Prim test passed\n");
+}
+
+void test_binary_graph_files() {
+    printf("Testing binary graph files...\n");
+
+    const char* dense_path = "test_graph_dense.bin";
+    const char* csr_path = "test_graph_csr.bin";
+    const int vertices = 45;
+
+    Graph* graph = create_graph(vertices);
+    srand(37);
+    for (int i = 1; i < vertices; i++) {
+        add_edge(graph, i, rand() % i, (rand() % 60) + 1);
+        add_edge(graph, rand() % vertices, rand() % vertices, (rand() % 60) + 1);
+    }
+    CSRGraph* csr = csr_from_graph(graph);
+
+    assert(save_graph_binary(dense_path, graph) == true);
+    assert(save_csr_graph_binary(csr_path, csr) == true);
+    assert(probe_graph_file(dense_path) == GRAPH_FILE_DENSE);
+    assert(probe_graph_file(csr_path) == GRAPH_FILE_CSR);
+    assert(load_csr_graph_binary(dense_path) == NULL);
+
+    Graph* loaded = load_graph_binary(dense_path);
+    assert(loaded != NULL);
+    assert(loaded->mapping != NULL);
+    assert(loaded->vertices == vertices);
+    assert(loaded->max_weight == graph->max_weight);
+    for (int i = 0; i < vertices; i++) {
+        for (int j = 0; j < vertices; j++) {
+            assert(graph_weight(loaded, i, j) == graph_weight(graph, i, j));
+        }
+    }
+
+    Graph* verified = load_graph_binary_verified(dense_path);
+    CSRGraph* verified_csr = load_csr_graph_binary_verified(csr_path);
+    assert(verified != NULL && verified_csr != NULL);
+    destroy_graph(verified);
+    destroy_csr_graph(verified_csr);
+
+    CSRGraph* loaded_csr = load_csr_graph_binary(csr_path);
+    assert(loaded_csr != NULL);
+    assert(loaded_csr->mapping != NULL);
+    assert(loaded_csr->edges == csr->edges);
+    assert(((size_t)loaded_csr->neighbors % CACHE_LINE_SIZE) == 0);
+
+    MST_Result* expected = prim_mst(graph, 0);
+    MST_Result* dense_result = prim_mst_dense(loaded, 0);
+    MST_Result* csr_result = prim_mst_csr(loaded_csr, 0);
+    assert(dense_result->total_weight == expected->total_weight);
+    assert(csr_result->total_weight == expected->total_weight);
+    assert(validate_mst_csr(loaded_csr, csr_result) == true);
+
+    long neighbors_at = (long)((char*)loaded_csr->neighbors - (char*)loaded_csr->mapping);
+    long weights_at = (long)((char*)loaded_csr->weights - (char*)loaded_csr->mapping);
+    int dense_first = graph_weight(graph, 0, 1);
+    int csr_first = loaded_csr->weights[0];
+
+    destroy_mst_result(expected);
+    destroy_mst_result(dense_result);
+    destroy_mst_result(csr_result);
+    destroy_graph(loaded);
+    destroy_csr_graph(loaded_csr);
+
+    long patches[][2] = {{neighbors_at, 1000000}, {neighbors_at, -1},
+                         {weights_at, graph->max_weight + 1}, {weights_at, -3},
+                         {(long)(sizeof(GraphFileHeader) + sizeof(int)), 1000000},
+                         {weights_at, csr_first == 1 ? 2 : 1}};
+    for (int i = 0; i < 6; i++) {
+        assert(save_csr_graph_binary(csr_path, csr) == true);
+        FILE* file = fopen(csr_path, "r+b");
+        int value = (int)patches[i][1];
+        assert(fseek(file, patches[i][0], SEEK_SET) == 0);
+        assert(fwrite(&value, sizeof(int), 1, file) == 1);
+        fclose(file);
+        if (i < 5) {
+            assert(load_csr_graph_binary(csr_path) == NULL);
+        } else {
+            destroy_csr_graph(load_csr_graph_binary(csr_path));
+        }
+        assert(load_csr_graph_binary_verified(csr_path) == NULL);
+    }
+
+    int one_way_offsets[] = {0, 4, 4, 4, 4, 4};
+    int one_way_neighbors[] = {1, 2, 3, 4};
+    int one_way_weights[] = {1, 1, 1, 1};
+    CSRGraph one_way = {5, 2, 1, one_way_offsets, one_way_neighbors, one_way_weights, NULL, 0};
+    assert(save_csr_graph_binary(csr_path, &one_way) == true);
+    assert(load_csr_graph_binary(csr_path) == NULL);
+    int skewed_offsets[] = {0, 1, 1, 2};
+    int skewed_neighbors[] = {1, 1};
+    CSRGraph skewed = {3, 1, 1, skewed_offsets, skewed_neighbors, one_way_weights, NULL, 0};
+    assert(save_csr_graph_binary(csr_path, &skewed) == true);
+    CSRGraph* unchecked = load_csr_graph_binary(csr_path);
+    assert(unchecked != NULL);
+    destroy_csr_graph(unchecked);
+    assert(load_csr_graph_binary_verified(csr_path) == NULL);
+
+    int dense_patches[] = {graph->max_weight + 1, dense_first == 1 ? 2 : 1, 5};
+    for (int i = 0; i < 3; i++) {
+        assert(save_graph_binary(dense_path, graph) == true);
+        FILE* file = fopen(dense_path, "r+b");
+        long at = (long)(sizeof(GraphFileHeader) + (i < 2 ? sizeof(int) : 0));
+        assert(fseek(file, at, SEEK_SET) == 0);
+        assert(fwrite(&dense_patches[i], sizeof(int), 1, file) == 1);
+        fclose(file);
+        if (i < 2) {
+            destroy_graph(load_graph_binary(dense_path));
+        } else {
+            assert(load_graph_binary(dense_path) == NULL);
+        }
+        assert(load_graph_binary_verified(dense_path) == NULL);
+    }
+
+    destroy_csr_graph(csr);
+    destroy_graph(graph);
+    remove(dense_path);
+    remove(csr_path);
+    printf("✓ Binary graph files test passed\n");
+}
+
+void test_edge_list_parsing() {
+    printf("Testing text edge list parsing...\n");
+
+    const char* dimacs = "c sample\np sp 4 5\na 1 2 10\na 1 3 6\na 1 4 5\na 2 4 15\na 3 4 4\n";
+    const char* snap = "# FromNodeId ToNodeId\n0\t1\t10\n0 2 6\n0 3 5\n\n1 3 15\n2 3 4";
+    const char* csv = "src,dst,weight\r\n0,1,10\r\n0,2,6\r\n0,3,5\r\n1,3,15\r\n2,3,4\r\n";
+
+    assert(detect_edge_list_format(NULL, dimacs, strlen(dimacs)) == EDGE_FORMAT_DIMACS);
+    assert(detect_edge_list_format(NULL, snap, strlen(snap)) == EDGE_FORMAT_SNAP);
+    assert(detect_edge_list_format(NULL, csv, strlen(csv)) == EDGE_FORMAT_CSV);
+    assert(detect_edge_list_format("graph.gr", snap, strlen(snap)) == EDGE_FORMAT_DIMACS);
+
+    const char* inputs[] = {dimacs, snap, csv};
+    for (int i = 0; i < 3; i++) {
+        CSRGraph* graph = parse_edge_list(inputs[i], strlen(inputs[i]), EDGE_FORMAT_AUTO, 1);
+        assert(graph != NULL);
+        assert(graph->vertices == 4);
+        assert(graph->edges == 5);
+        assert(csr_edge_weight(graph, 3, 2) == 4);
+
+        MST_Result* result = prim_mst_csr(graph, 0);
+        assert(result->total_weight == 19);
+        destroy_mst_result(result);
+        destroy_csr_graph(graph);
+    }
+
+    const char* symmetric = "p sp 4 10\na 1 2 10\na 2 1 10\na 1 3 6\na 3 1 6\na 1 4 5\n"
+                            "a 4 1 5\na 2 4 15\na 4 2 15\na 4 3 4\na 3 4 4\n";
+    CSRGraph* paired = parse_edge_list(symmetric, strlen(symmetric), EDGE_FORMAT_DIMACS, 1);
+    assert(paired->edges == 5);
+    assert(csr_edge_weight(paired, 3, 2) == 4);
+    destroy_csr_graph(paired);
+
+    const char* asymmetric = "p sp 3 3\na 1 2 10\na 2 1 7\na 3 2 1\n";
+    paired = parse_edge_list(asymmetric, strlen(asymmetric), EDGE_FORMAT_DIMACS, 1);
+    assert(paired->edges == 3);
+    destroy_csr_graph(paired);
+
+    CSRGraph* source = generate_erdos_renyi(3000, 6, 1000, 43);
+    char* text = (char*)safe_malloc((size_t)source->edges * 2 * 32 + 64);
+    size_t text_length = sprintf(text, "p sp %d %d\n", source->vertices, 2 * source->edges);
+    for (int u = 0; u < source->vertices; u++) {
+        for (int e = source->offsets[u]; e < source->offsets[u + 1]; e++) {
+            text_length += sprintf(text + text_length, "a %d %d %d\n",
+                                   u + 1, source->neighbors[e] + 1, source->weights[e]);
+        }
+    }
+    paired = parse_edge_list(text, text_length, EDGE_FORMAT_DIMACS, 1);
+    assert(paired->edges == source->edges);
+    for (int i = 0; i <= source->vertices; i++) {
+        assert(paired->offsets[i] == source->offsets[i]);
+    }
+    MST_Result* source_result = prim_mst_csr(source, 0);
+    MST_Result* paired_result = prim_mst_csr(paired, 0);
+    assert(source_result->total_weight == paired_result->total_weight);
+    destroy_mst_result(source_result);
+    destroy_mst_result(paired_result);
+    destroy_csr_graph(paired);
+    destroy_csr_graph(source);
+    safe_free((void**)&text);
+
+    const char* unweighted = "0 1\n1 2\n";
+    CSRGraph* graph = parse_edge_list(unweighted, strlen(unweighted), EDGE_FORMAT_SNAP, 1);
+    assert(graph->vertices == 3);
+    assert(csr_edge_weight(graph, 1, 2) == 1);
+    destroy_csr_graph(graph);
+
+    const char* negative = "0 1 -4\n";
+    assert(parse_edge_list(negative, strlen(negative), EDGE_FORMAT_SNAP, 1) == NULL);
+    const char* overflow = "p sp 2 1\na 1 3 4\n";
+    assert(parse_edge_list(overflow, strlen(overflow), EDGE_FORMAT_DIMACS, 1) == NULL);
+
+    const int lines = 150000;
+    char* big = (char*)safe_malloc((size_t)lines * 32);
+    size_t length = 0;
+    srand(41);
+    for (int i = 0; i < lines; i++) {
+        int src = (i < 49999) ? i + 1 : rand() % 50000;
+        int dest = (i < 49999) ? rand() % (i + 1) : rand() % 50000;
+        length += sprintf(big + length, "%d,%d,%d\n", src, dest, rand() % 1000);
+    }
+
+    CSRGraph* serial = parse_edge_list(big, length, EDGE_FORMAT_CSV, 1);
+    CSRGraph* parallel = parse_edge_list(big, length, EDGE_FORMAT_CSV, 4);
+    assert(serial->edges == parallel->edges);
+    assert(serial->vertices == parallel->vertices);
+    for (int i = 0; i <= serial->vertices; i++) {
+        assert(serial->offsets[i] == parallel->offsets[i]);
+    }
+
+    MST_Result* serial_result = prim_mst_csr(serial, 0);
+    MST_Result* parallel_result = prim_mst_csr(parallel, 0);
+    assert(serial_result->total_weight == parallel_result->total_weight);
+
+    destroy_mst_result(serial_result);
+    destroy_mst_result(parallel_result);
+    destroy_csr_graph(serial);
+    destroy_csr_graph(parallel);
+    safe_free((void**)&big);
+    printf("✓ Text edge list parsing test passed\n");
+}
+
+void test_generators() {
+    printf("Testing synthetic graph generators...\n");
+
+    CSRGraph* er = generate_erdos_renyi(500, 6.0, 100, 7);
+    assert(er->vertices == 500);
+    assert(er->edges > 499 && er->edges <= 1500);
+    assert(er->max_weight <= 100);
+
+    CSRGraph* er_again = generate_erdos_renyi(500, 6.0, 100, 7);
+    assert(er_again->edges == er->edges);
+    assert(memcmp(er_again->weights, er->weights, 2 * er->edges * sizeof(int)) == 0);
+
+    CSRGraph* grid = generate_grid(20, 30, 50, 11);
+    assert(grid->vertices == 600);
+    assert(grid->edges == 20 * 29 + 19 * 30);
+
+    CSRGraph* geometric = generate_geometric(800, 10.0, 1000, 13);
+    assert(geometric->vertices == 800);
+    assert(geometric->edges >= 799);
+
+    CSRGraph* sparse[] = {er, grid, geometric};
+    for (int i = 0; i < 3; i++) {
+        MST_Result* result = prim_mst_csr(sparse[i], 0);
+        MST_Result* parallel = boruvka_mst(sparse[i], 0, 2);
+        assert(validate_mst_csr(sparse[i], result) == true);
+        assert(parallel->total_weight == result->total_weight);
+        destroy_mst_result(parallel);
+        destroy_mst_result(result);
+    }
+
+    Graph* complete = generate_complete(64, 30, 17);
+    assert(complete->max_weight == 30);
+    for (int i = 0; i < 64; i++) {
+        for (int j = 0; j < 64; j++) {
+            assert(graph_weight(complete, i, j) == graph_weight(complete, j, i));
+            assert(i == j || graph_weight(complete, i, j) <= 30);
+        }
+    }
+
+    MST_Result* heap_result = prim_mst(complete, 0);
+    MST_Result* dense_result = prim_mst_dense(complete, 0);
+    assert(heap_result->total_weight == dense_result->total_weight);
+    assert(validate_mst(complete, dense_result) == true);
+
+    destroy_mst_result(heap_result);
+    destroy_mst_result(dense_result);
+    destroy_graph(complete);
+    destroy_csr_graph(er);
+    destroy_csr_graph(er_again);
+    destroy_csr_graph(grid);
+    destroy_csr_graph(geometric);
+    printf("✓ Graph generator test passed\n");
+}
+
+void test_incremental_mst() {
+    printf("Testing incremental MST updates...\n");
+
+    const int vertices = 60;
+    Graph* graph = create_graph(vertices);
+
+    srand(31);
+    for (int i = 1; i < vertices; i++) {
+        add_edge(graph, i, rand() % i, 50 + rand() % 50);
+    }
+
+    MST_Result* result = prim_mst(graph, 0);
+    int changed = 0;
+
+    for (int step = 0; step < 300; step++) {
+        int u = rand() % vertices;
+        int v = rand() % vertices;
+        int current = graph_weight(graph, u, v);
+        if (u == v) {
+            continue;
+        }
+
+        int weight = rand() % (current == INF ? 100 : current + 1);
+        add_edge(graph, u, v, weight);
+        if (mst_insert_edge(result, u, v, weight)) {
+            changed++;
+        }
+
+        MST_Result* fresh = prim_mst(graph, 0);
+        assert(result->total_weight == fresh->total_weight);
+        assert(validate_mst(graph, result) == true);
+        destroy_mst_result(fresh);
+    }
+
+    assert(changed > 0);
+    assert(mst_insert_edge(result, 3, 3, 0) == false);
+
+    MST_Result* forest = create_mst_result(4);
+    forest->key[0] = 0;
+    forest->key[2] = 0;
+    forest->parent[1] = 0;
+    forest->key[1] = 5;
+    forest->parent[3] = 2;
+    forest->key[3] = 7;
+    forest->total_weight = 12;
+    assert(mst_insert_edge(forest, 3, 1, 2) == true);
+    assert(forest->total_weight == 14);
+    assert(forest->parent[3] == 1 && forest->parent[2] == 3 && forest->key[2] == 7);
+
+    printf("Incremental updates changed the tree %d times\n", changed);
+
+    destroy_mst_result(forest);
+    destroy_mst_result(result);
+    destroy_graph(graph);
+    printf("✓ Incremental MST test passed\n");
+}
+
+void test_decremental_mst() {
+    printf("Testing decremental MST updates...\n");
+
+    const int vertices = 80;
+    Graph* graph = create_graph(vertices);
+
+    srand(37);
+    for (int i = 1; i < vertices; i++) {
+        add_edge(graph, i, rand() % i, rand() % 100);
+    }
+    for (int e = 0; e < vertices * 3; e++) {
+        add_edge(graph, rand() % vertices, rand() % vertices, rand() % 100);
+    }
+
+    MST_Result* result = prim_mst(graph, 0);
+    DynamicMST* dynamic = create_dynamic_mst(graph, result);
+    CSRGraph* csr = csr_from_graph(graph);
+    MST_Result* csr_result = prim_mst_csr(csr, 0);
+    DynamicMST* csr_dynamic = create_dynamic_mst_csr(csr, csr_result);
+    destroy_csr_graph(csr);
+    int replaced = 0;
+
+    for (int step = 0; step < 400; step++) {
+        int u;
+        int v;
+        if (step % 2 == 0) {
+            v = 1 + rand() % (vertices - 1);
+            while (result->parent[v] == -1) {
+                v = (v + 1) % vertices;
+            }
+            u = result->parent[v];
+        } else {
+            u = rand() % vertices;
+            v = (u + 1 + rand() % (vertices - 1)) % vertices;
+        }
+
+        int old_weight = graph_weight(graph, u, v);
+        assert(dynamic_mst_edge_weight(dynamic, u, v) == old_weight);
+        assert(dynamic_mst_edge_weight(csr_dynamic, u, v) == old_weight);
+
+        int weight = step % 5 == 0 ? INF : rand() % 150;
+        graph_row(graph, u)[v] = weight;
+        graph_row(graph, v)[u] = weight;
+        if (weight != INF && weight > graph->max_weight) {
+            graph->max_weight = weight;
+        }
+
+        if (!is_connected(graph)) {
+            graph_row(graph, u)[v] = old_weight;
+            graph_row(graph, v)[u] = old_weight;
+            continue;
+        }
+
+        if (dynamic_mst_update_edge(dynamic, u, v, weight)) {
+            replaced++;
+        }
+        dynamic_mst_update_edge(csr_dynamic, u, v, weight);
+
+        MST_Result* fresh = prim_mst(graph, 0);
+        assert(result->total_weight == fresh->total_weight);
+        assert(csr_result->total_weight == fresh->total_weight);
+        assert(validate_mst(graph, result) == true);
+        assert(validate_mst(graph, csr_result) == true);
+        destroy_mst_result(fresh);
+    }
+
+    assert(replaced > 0);
+    printf("Decremental updates changed the tree %d times\n", replaced);
+
+    destroy_dynamic_mst(csr_dynamic);
+    destroy_mst_result(csr_result);
+    destroy_dynamic_mst(dynamic);
+    destroy_mst_result(result);
+    destroy_graph(graph);
+
+    int multi_src[] = {0, 1, 0, 2, 1};
+    int multi_dest[] = {1, 0, 2, 2, 2};
+    int multi_weight[] = {5, 3, 8, 1, 6};
+    CSRGraph* multi = create_csr_graph(3, 5, multi_src, multi_dest, multi_weight);
+    MST_Result* multi_result = prim_mst_csr(multi, 0);
+    DynamicMST* multi_dynamic = create_dynamic_mst_csr(multi, multi_result);
+    assert(dynamic_mst_edge_weight(multi_dynamic, 0, 1) == 3);
+    assert(dynamic_mst_edge_weight(multi_dynamic, 1, 0) == 3);
+    assert(dynamic_mst_delete_edge(multi_dynamic, 0, 1) == true);
+    assert(dynamic_mst_edge_weight(multi_dynamic, 0, 1) == INF);
+    assert(multi_result->total_weight == 14);
+    destroy_dynamic_mst(multi_dynamic);
+    destroy_mst_result(multi_result);
+    destroy_csr_graph(multi);
+
+    Graph* path = create_graph(4);
+    add_edge(path, 0, 1, 1);
+    add_edge(path, 1, 2, 2);
+    add_edge(path, 2, 3, 3);
+    add_edge(path, 0, 3, 9);
+
+    MST_Result* tree = prim_mst(path, 0);
+    DynamicMST* path_dynamic = create_dynamic_mst(path, tree);
+
+    assert(dynamic_mst_delete_edge(path_dynamic, 1, 2) == true);
+    assert(tree->total_weight == 13);
+    assert(dynamic_mst_delete_edge(path_dynamic, 0, 3) == true);
+    assert(tree->total_weight == 4);
+    assert(tree->parent[3] == -1 && tree->parent[2] == 3);
+    assert(dynamic_mst_delete_edge(path_dynamic, 0, 2) == false);
+
+    destroy_dynamic_mst(path_dynamic);
+    destroy_mst_result(tree);
+    destroy_graph(path);
+    printf("✓ Decremental MST test passed\n");
+}
+
+void test_spanning_forest() {
+    printf("Testing minimum spanning forest...\n");
+
+    const int vertices = 90;
+    Graph* graph = create_graph(vertices);
+
+    srand(41);
+    for (int i = 0; i < vertices; i++) {
+        int block = i / 30;
+        if (i % 30 != 0 && i != 89) {
+            add_edge(graph, i, block * 30 + rand() % (i % 30), rand() % 40);
+        }
+        for (int k = 0; k < 2 && i != 89; k++) {
+            int j = block * 30 + rand() % 29;
+            add_edge(graph, i, j, rand() % 40);
+        }
+    }
+
+    CSRGraph* csr = csr_from_graph(graph);
+    MST_Forest* forests[3];
+    forests[0] = prim_msf(graph, 5);
+    forests[1] = prim_msf_csr(csr, 5);
+    forests[2] = boruvka_msf(csr, 5, 2);
+
+    for (int f = 0; f < 3; f++) {
+        MST_Forest* forest = forests[f];
+        assert(forest->component_count == 4);
+        assert(forest->root[0] == 5);
+        assert(forest->tree->total_weight == forests[0]->tree->total_weight);
+
+        long long sum = 0;
+        for (int c = 0; c < forest->component_count; c++) {
+            assert(forest->tree->parent[forest->root[c]] == -1);
+            assert(forest->component[forest->root[c]] == c);
+            sum += forest->component_weight[c];
+        }
+        assert(sum == forest->tree->total_weight);
+
+        for (int v = 0; v < vertices; v++) {
+            int c = forest->component[v];
+            assert(c >= 0 && c < forest->component_count);
+            assert((forest->component[v] == forest->component[0]) == (v < 30 && v != 89));
+            assert((forest->component[v] == forest->component[89]) == (v == 89));
+            if (forest->tree->parent[v] != -1) {
+                assert(graph_weight(graph, v, forest->tree->parent[v]) == forest->tree->key[v]);
+                assert(forest->component[forest->tree->parent[v]] == c);
+            }
+            assert(forest->component_weight[c] ==
+                   forests[0]->component_weight[forests[0]->component[v]]);
+        }
+    }
+
+    for (int f = 0; f < 3; f++) {
+        destroy_mst_forest(forests[f]);
+    }
+
+    Graph* connected = create_graph(4);
+    add_edge(connected, 0, 1, 3);
+    add_edge(connected, 1, 2, 1);
+    add_edge(connected, 2, 3, 4);
+    add_edge(connected, 0, 3, 2);
+    MST_Forest* single = prim_msf(connected, 0);
+    MST_Result* reference = prim_mst(connected, 0);
+    assert(single->component_count == 1);
+    assert(single->component_weight[0] == reference->total_weight);
+
+    destroy_mst_result(reference);
+    destroy_mst_forest(single);
+    destroy_graph(connected);
+    destroy_csr_graph(csr);
+    destroy_graph(graph);
+    printf("✓ Spanning forest test passed\n");
+}
+
+void test_arena_workspace() {
+    printf("Testing arena allocator and MST workspace...\n");
+
+    Arena* arena = create_arena(256);
+    char* first = (char*)arena_alloc(arena, 10);
+    char* second = (char*)arena_alloc(arena, 100);
+    assert(((size_t)first % CACHE_LINE_SIZE) == 0);
+    assert(((size_t)second % CACHE_LINE_SIZE) == 0);
+    assert(second == first + CACHE_LINE_SIZE);
+
+    arena_alloc(arena, 1000);
+    assert(arena_capacity(arena) >= 1256);
+    assert(arena_high_water(arena) >= 1000);
+
+    size_t high_water = arena_high_water(arena);
+    assert(arena_capacity(arena) > high_water);
+    arena_reset(arena);
+    assert(arena_capacity(arena) == high_water);
+    char* reused = (char*)arena_alloc(arena, 10);
+    arena_alloc(arena, 100);
+    arena_alloc(arena, 1000);
+    assert(reused != NULL);
+    assert(arena_capacity(arena) == high_water);
+    arena_reset(arena);
+    assert(arena_capacity(arena) == high_water);
+    destroy_arena(arena);
+
+    const int max_vertices = 40;
+    MSTWorkspace* workspace = create_mst_workspace(8);
+    int parent[40];
+    int key[40];
+    PriorityQueue* bucket = NULL;
+    size_t steady_capacity = 0;
+
+    srand(43);
+    for (int round = 0; round < 60; round++) {
+        int vertices = round == 0 ? max_vertices : 2 + rand() % (max_vertices - 1);
+        Graph* graph = create_graph(vertices);
+        for (int i = 1; i < vertices; i++) {
+            add_edge(graph, i, rand() % i, rand() % 100);
+            add_edge(graph, rand() % vertices, rand() % vertices, rand() % 100);
+        }
+        add_edge(graph, 0, 1, 99);
+        CSRGraph* csr = csr_from_graph(graph);
+
+        MST_Result into = { parent, key, 0, vertices };
+        MST_Result* expected = prim_mst(graph, 0);
+
+        prim_mst_into(workspace, graph, 0, &into);
+        assert(into.total_weight == expected->total_weight);
+        assert(validate_mst(graph, &into) == true);
+
+        prim_mst_csr_into(workspace, csr, 0, &into);
+        assert(into.total_weight == expected->total_weight);
+        assert(validate_mst_csr(csr, &into) == true);
+
+        if (round == 0) {
+            bucket = mst_workspace_queue(workspace, 1, PQ_BUCKET_QUEUE, 99);
+            steady_capacity = arena_capacity(mst_workspace_arena(workspace));
+        } else {
+            assert(mst_workspace_queue(workspace, vertices, PQ_BUCKET_QUEUE, 99) == bucket);
+            assert(arena_capacity(mst_workspace_arena(workspace)) == steady_capacity);
+        }
+
+        destroy_mst_result(expected);
+        destroy_csr_graph(csr);
+        destroy_graph(graph);
+    }
+
+    destroy_mst_workspace(workspace);
+    printf("✓ Arena and workspace test passed\n");
+}
+
+void test_mst_batch() {
+    printf("Testing batch MST solver...\n");
+
+    const int count = 48;
+    Graph* graphs[48];
+    long long expected[48];
+    int expected_components[48];
+    int components[48];
+
+    srand(47);
+    for (int g = 0; g < count; g++) {
+        int vertices = g % 7 == 0 ? 150 + rand() % 100 : 2 + rand() % 40;
+        graphs[g] = create_graph(vertices);
+        if (g % 5 == 3) {
+            int half = vertices / 2;
+            for (int i = 1; i < vertices; i++) {
+                if (i != half) {
+                    int base = i < half ? 0 : half;
+                    add_edge(graphs[g], i, base + rand() % (i - base), rand() % 50);
+                }
+            }
+        } else {
+            for (int i = 1; i < vertices; i++) {
+                add_edge(graphs[g], i, rand() % i, rand() % (g % 2 ? 50 : 20000));
+                add_edge(graphs[g], rand() % vertices, rand() % vertices, rand() % 50);
+            }
+        }
+
+        MST_Forest* forest = prim_msf(graphs[g], 0);
+        expected[g] = forest->tree->total_weight;
+        expected_components[g] = forest->component_count;
+        destroy_mst_forest(forest);
+        assert(expected_components[g] == (g % 5 == 3 ? 2 : 1));
+    }
+
+    int thread_counts[] = {1, 3, 0, 64};
+    for (int t = 0; t < 4; t++) {
+        MST_Result* results = prim_mst_batch(graphs, count, thread_counts[t], components);
+        for (int g = 0; g < count; g++) {
+            assert(results[g].vertex_count == graphs[g]->vertices);
+            assert(results[g].total_weight == expected[g]);
+            assert(components[g] == expected_components[g]);
+            if (components[g] == 1) {
+                assert(validate_mst(graphs[g], &results[g]) == true);
+            } else {
+                int roots = 0;
+                for (int v = 0; v < graphs[g]->vertices; v++) {
+                    roots += results[g].parent[v] == -1;
+                }
+                assert(roots == components[g]);
+            }
+        }
+        destroy_mst_batch(results, count);
+    }
+
+    MST_Result* unchecked = prim_mst_batch(graphs, count, 2, NULL);
+    assert(unchecked[3].total_weight == expected[3]);
+    destroy_mst_batch(unchecked, count);
+
+    for (int g = 0; g < count; g++) {
+        destroy_graph(graphs[g]);
+    }
+    printf("✓ Batch MST test passed\n");
+}
+
+void test_weighted_graphs() {
+    printf("Testing typed weight graphs...\n");
+
+    const int vertices = 50;
+    Graph* reference = create_graph(vertices);
+    Graph_u8* narrow = create_graph_u8(vertices);
+    Graph_u16* medium = create_graph_u16(vertices);
+    int src[200];
+    int dest[200];
+    uint16_t weight[200];
+    int edge_count = 0;
+
+    srand(53);
+    for (int i = 1; i < vertices; i++) {
+        for (int k = 0; k < 3; k++) {
+            int j = k == 0 ? rand() % i : rand() % vertices;
+            int w = rand() % 255;
+            if (i == j || graph_weight(reference, i, j) != INF) {
+                continue;
+            }
+            add_edge(reference, i, j, w);
+            add_edge_u8(narrow, i, j, (uint8_t)w);
+            add_edge_u16(medium, i, j, (uint16_t)w);
+            src[edge_count] = i;
+            dest[edge_count] = j;
+            weight[edge_count] = (uint16_t)w;
+            edge_count++;
+        }
+    }
+
+    MST_Result* expected = prim_mst(reference, 0);
+    MST_Result_u8* narrow_result = prim_mst_u8(narrow, 0);
+    MST_Result_u16* medium_result = prim_mst_u16(medium, 0);
+    CSRGraph_u16* medium_csr = create_csr_graph_u16(vertices, edge_count, src, dest, weight);
+    MST_Result_u16* csr_result = prim_mst_csr_u16(medium_csr, 0);
+
+    assert(narrow->stride % 64 == 0 && medium->stride % 32 == 0);
+    assert(narrow_result->total_weight == expected->total_weight);
+    assert(medium_result->total_weight == expected->total_weight);
+    assert(csr_result->total_weight == expected->total_weight);
+    for (int v = 1; v < vertices; v++) {
+        int p = narrow_result->parent[v];
+        assert(graph_weight(reference, v, p) == narrow_result->key[v]);
+    }
+
+    destroy_mst_result_u16(csr_result);
+    destroy_csr_graph_u16(medium_csr);
+    destroy_mst_result_u16(medium_result);
+    destroy_mst_result_u8(narrow_result);
+    destroy_mst_result(expected);
+    destroy_graph_u16(medium);
+    destroy_graph_u8(narrow);
+    destroy_graph(reference);
+
+    Graph* rejected = create_graph(3);
+    assert(add_edge(rejected, 0, 1, INF - 1));
+    assert(!add_edge(rejected, 1, 2, INF));
+    assert(!add_edge(rejected, 1, 2, -1));
+    assert(!add_edge(rejected, 0, 3, 5));
+    assert(graph_weight(rejected, 1, 2) == INF);
+    destroy_graph(rejected);
+
+    int bad_src[] = {0, 1};
+    int bad_dest[] = {1, 2};
+    int bad_weight[] = {5, INF};
+    assert(create_csr_graph(3, 2, bad_src, bad_dest, bad_weight) == NULL);
+    bad_weight[1] = 5;
+    bad_dest[1] = 3;
+    assert(create_csr_graph(3, 2, bad_src, bad_dest, bad_weight) == NULL);
+
+    const int heavy_vertices = 3000;
+    int* heavy_src = (int*)safe_malloc(heavy_vertices * sizeof(int));
+    int* heavy_dest = (int*)safe_malloc(heavy_vertices * sizeof(int));
+    int* heavy_weight = (int*)safe_malloc(heavy_vertices * sizeof(int));
+    for (int i = 0; i < heavy_vertices - 1; i++) {
+        heavy_src[i] = i;
+        heavy_dest[i] = i + 1;
+        heavy_weight[i] = INF - 1;
+    }
+    CSRGraph* heavy = create_csr_graph(heavy_vertices, heavy_vertices - 1,
+                                       heavy_src, heavy_dest, heavy_weight);
+    MST_Result* heavy_result = prim_mst_csr(heavy, 0);
+    assert(heavy_result->total_weight == (long long)(heavy_vertices - 1) * (INF - 1));
+    assert(heavy_result->total_weight > INT_MAX);
+    assert(validate_mst_csr(heavy, heavy_result));
+    destroy_mst_result(heavy_result);
+    destroy_csr_graph(heavy);
+    safe_free((void**)&heavy_src);
+    safe_free((void**)&heavy_dest);
+    safe_free((void**)&heavy_weight);
+
+    Graph_i32* wide = create_graph_i32(3);
+    add_edge_i32(wide, 0, 1, 2000000000);
+    add_edge_i32(wide, 1, 2, 1999999);
+    add_edge_i32(wide, 0, 2, 2000000001);
+    MST_Result_i32* wide_result = prim_mst_i32(wide, 0);
+    assert(wide_result->total_weight == 2001999999LL);
+    destroy_mst_result_i32(wide_result);
+    destroy_graph_i32(wide);
+
+    int chain_src[] = {0, 1, 2, 0};
+    int chain_dest[] = {1, 2, 3, 3};
+    int64_t chain_weight[] = {INT64_C(4000000000), INT64_C(5000000000), -7, INT64_C(9000000000)};
+    CSRGraph_i64* chain = create_csr_graph_i64(4, 4, chain_src, chain_dest, chain_weight);
+    MST_Result_i64* chain_result = prim_mst_csr_i64(chain, 0);
+    assert(chain_result->total_weight == INT64_C(8999999993));
+    destroy_mst_result_i64(chain_result);
+    destroy_csr_graph_i64(chain);
+
+    Graph_f32* single = create_graph_f32(4);
+    Graph_f64* precise = create_graph_f64(4);
+    double real_weights[] = {0.5, 1.25, 0.75, 2.5};
+    for (int i = 0; i < 4; i++) {
+        add_edge_f32(single, i, (i + 1) % 4, (float)real_weights[i]);
+        add_edge_f64(precise, i, (i + 1) % 4, real_weights[i]);
+    }
+    MST_Result_f32* single_result = prim_mst_f32(single, 0);
+    MST_Result_f64* precise_result = prim_mst_f64(precise, 0);
+    assert(fabs(single_result->total_weight - 2.5) < 1e-6);
+    assert(precise_result->total_weight == 2.5);
+    assert(graph_row_f64(precise, 0)[2] == WEIGHT_NONE_f64);
+
+    assert(add_edge_f64(precise, 0, 2, 9.0));
+    assert(!add_edge_f64(precise, 0, 4, 1.0));
+    assert(!add_edge_f64(precise, 0, 2, WEIGHT_NONE_f64));
+    assert(!add_edge_f64(precise, 0, 2, NAN));
+    assert(graph_row_f64(precise, 0)[2] == 9.0);
+    Graph_u8* tiny = create_graph_u8(3);
+    assert(!add_edge_u8(tiny, -1, 0, 1));
+    assert(!add_edge_u8(tiny, 0, 1, WEIGHT_NONE_u8));
+    assert(add_edge_u8(tiny, 2, 2, 1));
+    assert(graph_row_u8(tiny, 0)[1] == WEIGHT_NONE_u8);
+    destroy_graph_u8(tiny);
+
+    int typed_src[] = {0, 1};
+    int typed_dest[] = {1, 2};
+    uint16_t typed_weight[] = {3, WEIGHT_NONE_u16};
+    assert(create_csr_graph_u16(3, 2, typed_src, typed_dest, typed_weight) == NULL);
+    typed_weight[1] = 4;
+    typed_dest[1] = 3;
+    assert(create_csr_graph_u16(3, 2, typed_src, typed_dest, typed_weight) == NULL);
+    typed_dest[1] = 2;
+    CSRGraph_u16* good_csr = create_csr_graph_u16(3, 2, typed_src, typed_dest, typed_weight);
+    assert(good_csr != NULL && good_csr->edges == 2);
+    destroy_csr_graph_u16(good_csr);
+
+    destroy_mst_result_f32(single_result);
+    destroy_mst_result_f64(precise_result);
+    destroy_graph_f32(single);
+    destroy_graph_f64(precise);
+    printf("✓ Typed weight graph test passed\n");
+}
+
+typedef struct {
+    const float* points;
+    int dimensions;
+} PointCloud;
+
+static double point_distance(int u, int v, void* context) {
+    const PointCloud* cloud = (const PointCloud*)context;
+    double sum = 0.0;
+    for (int k = 0; k < cloud->dimensions; k++) {
+        double diff = (double)cloud->points[u * cloud->dimensions + k] -
+                      cloud->points[v * cloud->dimensions + k];
+        sum += diff * diff;
+    }
+    return sqrt(sum);
+}
+
+void test_euclidean_mst() {
+    printf("Testing implicit Euclidean MST...\n");
+
+    const int count = 300;
+    float points[300 * 3];
+
+    srand(61);
+    for (int dimensions = 2; dimensions <= 3; dimensions++) {
+        for (int i = 0; i < count * dimensions; i++) {
+            points[i] = (float)(rand() % 10000) / 100.0f;
+        }
+
+        PointCloud cloud = {points, dimensions};
+        MST_Result_f64* implicit = implicit_mst(count, point_distance, &cloud, 0);
+        MST_Result_f64* scalar = euclidean_mst_kernel(points, count, dimensions, 0,
+                                                      DENSE_KERNEL_SCALAR);
+        MST_Result_f64* automatic = euclidean_mst(points, count, dimensions, 7);
+        MST_Result_f64* kdtree = euclidean_mst_kdtree(points, count, dimensions, 7);
+
+        double expected = implicit->total_weight;
+        assert(fabs(scalar->total_weight - expected) < 1e-3 * expected);
+        assert(fabs(automatic->total_weight - expected) < 1e-3 * expected);
+        assert(fabs(kdtree->total_weight - expected) < 1e-3 * expected);
+
+        if (dense_kernel_supported(DENSE_KERNEL_AVX2)) {
+            MST_Result_f64* avx2 = euclidean_mst_kernel(points, count, dimensions, 0,
+                                                        DENSE_KERNEL_AVX2);
+            assert(fabs(avx2->total_weight - expected) < 1e-3 * expected);
+            destroy_mst_result_f64(avx2);
+        }
+
+        assert(kdtree->parent[7] == -1);
+        for (int v = 0; v < count; v++) {
+            if (v != 7) {
+                assert(kdtree->parent[v] >= 0);
+                double edge = point_distance(v, kdtree->parent[v], &cloud);
+                assert(fabs(kdtree->key[v] - edge) < 1e-3);
+            }
+        }
+
+        destroy_mst_result_f64(implicit);
+        destroy_mst_result_f64(scalar);
+        destroy_mst_result_f64(automatic);
+        destroy_mst_result_f64(kdtree);
+    }
+
+    float duplicates[4 * 2] = {1.0f, 1.0f, 1.0f, 1.0f, 4.0f, 5.0f, 1.0f, 1.0f};
+    MST_Result_f64* tied = euclidean_mst_kdtree(duplicates, 4, 2, 0);
+    assert(fabs(tied->total_weight - 5.0) < 1e-9);
+    destroy_mst_result_f64(tied);
+
+    MST_Result_f64* single = euclidean_mst(points, 1, 2, 0);
+    assert(single->total_weight == 0.0);
+    assert(single->parent[0] == -1);
+    destroy_mst_result_f64(single);
+
+    printf("✓ Implicit Euclidean MST test passed\n");
+}
+
+void test_external_mst() {
+    printf("Testing external-memory MST...\n");
+
+    const char* path = "/tmp/prim_test_edges.bin";
+    CSRGraph* graph = generate_erdos_renyi(2000, 16, 500, 71);
+    EdgeFileWriter* writer = create_edge_file(path, graph->vertices, 4096);
+    assert(writer != NULL);
+
+    for (int u = 0; u < graph->vertices; u++) {
+        for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            if (graph->neighbors[e] > u) {
+                assert(edge_file_append(writer, u, graph->neighbors[e], graph->weights[e]));
+            }
+        }
+    }
+    assert(edge_file_append(writer, 5, 5, 0));
+    assert(edge_file_append(writer, 9, 3, 499));
+    assert(!edge_file_append(writer, 0, 2000, 1));
+    assert(close_edge_file(writer));
+    assert(probe_graph_file(path) == GRAPH_FILE_EDGES);
+
+    MST_Result* expected = prim_mst_csr(graph, 0);
+
+    ExternalMSTStats stats;
+    MST_Result* in_core = external_mst(path, 0, NULL, &stats);
+    assert(in_core != NULL);
+    assert(in_core->total_weight == expected->total_weight);
+    assert(validate_mst_csr(graph, in_core) == true);
+    assert(stats.run_count == 1 && stats.merge_passes == 0);
+    assert(stats.edges_read == graph->edges + 2);
+    destroy_mst_result(in_core);
+
+    ExternalMSTConfig config = default_external_config();
+    config.io_buffer_size = 4096;
+    config.memory_budget = (size_t)2000 * 17 + 3 * 4096;
+    config.temp_dir = "/tmp";
+
+    MST_Result* spilled = external_mst(path, 0, &config, &stats);
+    assert(spilled != NULL);
+    assert(spilled->total_weight == expected->total_weight);
+    assert(validate_mst_csr(graph, spilled) == true);
+    assert(stats.run_count <= 3 && stats.merge_passes >= 1);
+    assert(stats.edges_scanned <= stats.edges_read);
+    destroy_mst_result(spilled);
+
+    config.memory_budget = 2000;
+    assert(external_mst(path, 0, &config, NULL) == NULL);
+
+    Graph* split = create_graph(6);
+    writer = create_edge_file(path, 6, 4096);
+    assert(writer != NULL);
+    int split_edges[][3] = {{0, 1, 4}, {1, 2, 3}, {0, 2, 9}, {3, 4, 7}};
+    for (int i = 0; i < 4; i++) {
+        add_edge(split, split_edges[i][0], split_edges[i][1], split_edges[i][2]);
+        assert(edge_file_append(writer, split_edges[i][0], split_edges[i][1], split_edges[i][2]));
+    }
+    assert(close_edge_file(writer));
+
+    assert(external_mst(path, 0, NULL, NULL) == NULL);
+
+    MST_Forest* forest = external_msf(path, 0, NULL, &stats);
+    MST_Forest* in_memory = prim_msf(split, 0);
+    assert(forest != NULL);
+    assert(stats.edges_read == 4);
+    assert(forest->component_count == 3);
+    assert(forest->component_count == in_memory->component_count);
+    assert(forest->tree->total_weight == 14);
+    assert(forest->tree->total_weight == in_memory->tree->total_weight);
+    assert(forest->component[2] == forest->component[0]);
+    assert(forest->component[3] != forest->component[0]);
+    assert(forest->component[5] != forest->component[3]);
+    assert(forest->component_weight[forest->component[0]] == 7);
+    destroy_mst_forest(in_memory);
+    destroy_mst_forest(forest);
+    destroy_graph(split);
+
+    remove(path);
+    destroy_mst_result(expected);
+    destroy_csr_graph(graph);
+    printf("✓ External-memory MST test passed\n");
+}
+
+void test_streaming_mst() {
+    printf("Testing semi-streaming MST...\n");
+
+    const int vertices = 120;
+    Graph* graph = create_graph(vertices);
+    StreamingMST* stream = create_streaming_mst(vertices);
+
+    srand(83);
+    for (int i = 0; i < 2500; i++) {
+        int u = rand() % vertices;
+        int v = rand() % (i < 600 ? vertices / 2 : vertices);
+        int w = rand() % 1000;
+
+        streaming_mst_add_edge(stream, u, v, w);
+        if (u != v && w < graph_weight(graph, u, v)) {
+            add_edge(graph, u, v, w);
+        }
+
+        if (i == 599) {
+            MST_Forest* partial = streaming_msf_snapshot(stream, 0);
+            MST_Forest* expected = prim_msf(graph, 0);
+            assert(partial->component_count == expected->component_count);
+            assert(partial->tree->total_weight == expected->tree->total_weight);
+            assert(streaming_mst_edge_count(stream) == vertices - partial->component_count);
+            destroy_mst_forest(partial);
+            destroy_mst_forest(expected);
+        }
+    }
+
+    StreamingMST* split = create_streaming_mst(5);
+    assert(streaming_mst_add_edge(split, 0, 1, 2));
+    assert(streaming_mst_add_edge(split, 3, 4, 6));
+    assert(streaming_mst_snapshot(split, 0) == NULL);
+    MST_Forest* split_forest = streaming_msf_snapshot(split, 0);
+    assert(split_forest->component_count == 3);
+    assert(split_forest->tree->total_weight == 8);
+    destroy_mst_forest(split_forest);
+    assert(streaming_mst_add_edge(split, 1, 2, 1));
+    assert(streaming_mst_add_edge(split, 2, 3, 5));
+    MST_Result* joined = streaming_mst_snapshot(split, 0);
+    assert(joined != NULL && joined->total_weight == 14);
+    destroy_mst_result(joined);
+    destroy_streaming_mst(split);
+
+    assert(streaming_mst_edges_seen(stream) == 2500);
+    assert(streaming_mst_edge_count(stream) == vertices - 1);
+
+    MST_Result* expected = prim_mst(graph, 0);
+    MST_Result* snapshot = streaming_mst_snapshot(stream, 0);
+    assert(snapshot->total_weight == expected->total_weight);
+    assert(streaming_mst_weight(stream) == expected->total_weight);
+    assert(validate_mst(graph, snapshot) == true);
+
+    assert(!streaming_mst_add_edge(stream, 3, 3, 0));
+    assert(!streaming_mst_add_edge(stream, 0, vertices, 1));
+    assert(!streaming_mst_add_edge(stream, 0, 1, -1));
+    assert(!streaming_mst_add_edge(stream, 0, 1, INF));
+    assert(!streaming_mst_add_edge(stream, 0, 1, INT_MIN));
+    assert(streaming_mst_edges_seen(stream) == 2501);
+    assert(streaming_mst_weight(stream) == expected->total_weight);
+    int heaviest = 0;
+    for (int v = 1; v < vertices; v++) {
+        if (snapshot->key[v] > snapshot->key[heaviest]) {
+            heaviest = v;
+        }
+    }
+    assert(streaming_mst_add_edge(stream, heaviest, snapshot->parent[heaviest],
+                                  snapshot->key[heaviest] - 1));
+    assert(streaming_mst_weight(stream) == expected->total_weight - 1);
+
+    destroy_mst_result(snapshot);
+    destroy_mst_result(expected);
+    destroy_streaming_mst(stream);
+    destroy_graph(graph);
+    printf("✓ Semi-streaming MST test passed\n");
+}
+
+void test_instrumentation() {
+    printf("Testing hot-path instrumentation...\n");
+
+    CSRGraph* graph = generate_erdos_renyi(500, 8, 100000, 101);
+
+    instrument_reset();
+    MST_Result* result = prim_mst_csr_with_pq(graph, 0, PQ_BINARY_HEAP);
+    assert(validate_mst_csr(graph, result) == true);
+
+    InstrumentTotals totals;
+    instrument_totals(&totals);
+
+    if (instrument_enabled()) {
+        uint64_t taken = totals.counters[INSTR_RELAX_TAKEN];
+        assert(totals.threads >= 1);
+        assert(totals.counters[INSTR_HEAP_INSERTS] == 500);
+        assert(totals.counters[INSTR_HEAP_EXTRACTS] == 500);
+        assert(totals.counters[INSTR_RELAX_SCANNED] == (uint64_t)2 * graph->edges);
+        assert(taken == totals.counters[INSTR_HEAP_INSERTS] - 1 +
+                        totals.counters[INSTR_DECREASE_KEYS]);
+        assert(totals.counters[INSTR_COMPARISONS] >= totals.counters[INSTR_HEAP_SIFTS]);
+    } else {
+        assert(totals.threads == 0);
+        for (int c = 0; c < INSTR_COUNTER_COUNT; c++) {
+            assert(totals.counters[c] == 0);
+        }
+    }
+
+    assert(strcmp(instrument_counter_name(INSTR_RELAX_TAKEN), "relax_taken") == 0);
+    assert(strcmp(instrument_phase_name(INSTR_PHASE_SOLVE), "solve") == 0);
+
+    FILE* out = tmpfile();
+    assert(out != NULL);
+    instrument_dump_json(out);
+    rewind(out);
+
+    char json[16384];
+    size_t length = fread(json, 1, sizeof(json) - 1, out);
+    json[length] = '\0';
+    fclose(out);
+
+    assert(length < sizeof(json) - 1);
+    assert(strncmp(json, "{\"enabled\": ", 12) == 0);
+    assert(strstr(json, "\"relax_scanned\"") != NULL);
+    assert(strstr(json, "\"phase_ns\"") != NULL);
+    assert(json[length - 2] == '}');
+
+    destroy_mst_result(result);
+    destroy_csr_graph(graph);
+    printf("✓ Instrumentation test passed\n");
+}
+
+static int csr_bandwidth(CSRGraph* graph) {
+    int bandwidth = 0;
+    for (int u = 0; u < graph->vertices; u++) {
+        for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+            int distance = abs(graph->neighbors[e] - u);
+            if (distance > bandwidth) {
+                bandwidth = distance;
+            }
+        }
+    }
+    return bandwidth;
+}
+
+void test_vertex_reordering() {
+    printf("Testing vertex reordering...\n");
+
+    CSRGraph* grid = generate_grid(30, 40, 1000, 7);
+    int vertices = grid->vertices;
+    int* shuffle = (int*)safe_malloc(vertices * sizeof(int));
+    for (int i = 0; i < vertices; i++) {
+        shuffle[i] = i;
+    }
+    srand(97);
+    for (int i = vertices - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int temp = shuffle[i];
+        shuffle[i] = shuffle[j];
+        shuffle[j] = temp;
+    }
+
+    CSRGraph* graph = permute_csr_graph(grid, shuffle);
+    MST_Result* expected = prim_mst_csr(graph, 5);
+    VertexOrder orders[] = {ORDER_IDENTITY, ORDER_BFS, ORDER_RCM, ORDER_DEGREE};
+
+    for (int k = 0; k < 4; k++) {
+        int* order = compute_vertex_order(graph, orders[k], 5);
+        int* rank = invert_vertex_order(order, vertices);
+        bool* seen = (bool*)calloc(vertices, sizeof(bool));
+        for (int i = 0; i < vertices; i++) {
+            assert(!seen[order[i]]);
+            seen[order[i]] = true;
+            assert(rank[order[i]] == i);
+        }
+
+        CSRGraph* permuted = permute_csr_graph(graph, order);
+        assert(permuted->edges == graph->edges);
+        for (int u = 0; u < vertices; u += 37) {
+            for (int e = graph->offsets[u]; e < graph->offsets[u + 1]; e++) {
+                int v = graph->neighbors[e];
+                assert(csr_edge_weight(permuted, rank[u], rank[v]) == graph->weights[e]);
+            }
+        }
+
+        if (orders[k] == ORDER_RCM) {
+            assert(csr_bandwidth(permuted) * 4 < csr_bandwidth(graph));
+        }
+        if (orders[k] == ORDER_BFS) {
+            assert(order[0] == 5);
+        }
+
+        MST_Result* result = prim_mst_csr_reordered(graph, 5, orders[k]);
+        assert(result->total_weight == expected->total_weight);
+        assert(result->parent[5] == -1);
+        assert(validate_mst_csr(graph, result) == true);
+
+        destroy_mst_result(result);
+        destroy_csr_graph(permuted);
+        safe_free((void**)&order);
+        safe_free((void**)&rank);
+        free(seen);
+    }
+
+    int src[] = {0, 1, 4, 5};
+    int dest[] = {1, 2, 5, 6};
+    int weight[] = {3, 1, 2, 2};
+    CSRGraph* split = create_csr_graph(8, 4, src, dest, weight);
+    for (int k = 1; k < 4; k++) {
+        int* order = compute_vertex_order(split, orders[k], 6);
+        int sum = 0;
+        for (int i = 0; i < 8; i++) {
+            sum += order[i];
+        }
+        assert(sum == 28);
+        safe_free((void**)&order);
+    }
+    assert(strcmp(vertex_order_name(ORDER_RCM), "rcm") == 0);
+
+    destroy_csr_graph(split);
+    destroy_mst_result(expected);
+    destroy_csr_graph(graph);
+    destroy_csr_graph(grid);
+    safe_free((void**)&shuffle);
+    printf("✓ Vertex reordering test passed\n");
+}
+
+void test_kruskal_auto() {
+    printf("Testing Kruskal and engine selection...\n");
+
+    UnionFind* uf = create_union_find(6);
+    assert(union_find_union(uf, 0, 1) == true);
+    assert(union_find_union(uf, 2, 3) == true);
+    assert(union_find_union(uf, 1, 0) == false);
+    assert(union_find_union(uf, 1, 3) == true);
+    assert(union_find_find(uf, 0) == union_find_find(uf, 2));
+    assert(union_find_find(uf, 4) != union_find_find(uf, 0));
+    assert(uf->sets == 3);
+    destroy_union_find(uf);
+
+    KruskalEdge edges[200];
+    srand(11);
+    for (int i = 0; i < 200; i++) {
+        edges[i].src = i;
+        edges[i].dest = i + 1;
+        edges[i].weight = rand() % 5000;
+    }
+    sort_kruskal_edges(edges, 200, 4999);
+    for (int i = 1; i < 200; i++) {
+        assert(edges[i - 1].weight <= edges[i].weight);
+    }
+
+    int weights[] = {50, 200000};
+    for (int w = 0; w < 2; w++) {
+        CSRGraph* graph = generate_erdos_renyi(20000, 6.0, weights[w], 3);
+        assert(graph->edges > FILTER_KRUSKAL_BASE);
+        MST_Result* expected = prim_mst_csr(graph, 0);
+
+        MST_Result* kruskal = kruskal_mst(graph, 4);
+        assert(kruskal->total_weight == expected->total_weight);
+        assert(kruskal->parent[4] == -1);
+        assert(validate_mst_csr(graph, kruskal) == true);
+
+        MST_Result* filtered = filter_kruskal_mst(graph, 4);
+        assert(filtered->total_weight == expected->total_weight);
+        assert(validate_mst_csr(graph, filtered) == true);
+
+        MST_Result* automatic = mst_auto(graph, 0, 1);
+        assert(automatic->total_weight == expected->total_weight);
+
+        destroy_mst_result(expected);
+        destroy_mst_result(kruskal);
+        destroy_mst_result(filtered);
+        destroy_mst_result(automatic);
+        destroy_csr_graph(graph);
+    }
+
+    CSRGraph* small = generate_geometric(400, 12.0, 1000, 5);
+    MST_Result* expected = prim_mst_csr(small, 0);
+    MSTEngine engines[] = {MST_ENGINE_DENSE_PRIM, MST_ENGINE_DENSE_PARALLEL_PRIM, MST_ENGINE_HEAP_PRIM,
+                           MST_ENGINE_BUCKET_PRIM, MST_ENGINE_KRUSKAL, MST_ENGINE_FILTER_KRUSKAL,
+                           MST_ENGINE_BORUVKA};
+    for (int e = 0; e < 7; e++) {
+        MST_Result* result = mst_run_engine(small, 0, engines[e], 2);
+        assert(result->total_weight == expected->total_weight);
+        assert(validate_mst_csr(small, result) == true);
+        destroy_mst_result(result);
+    }
+
+    Graph* dense = graph_from_csr(small);
+    assert(dense->max_weight == small->max_weight);
+    for (int u = 0; u < small->vertices; u += 17) {
+        for (int k = small->offsets[u]; k < small->offsets[u + 1]; k++) {
+            assert(graph_weight(dense, u, small->neighbors[k]) == small->weights[k]);
+        }
+    }
+    for (int e = 0; e < 7; e++) {
+        MST_Result* result = mst_run_engine_dense(dense, 0, engines[e], 2);
+        assert(result->total_weight == expected->total_weight);
+        assert(validate_mst(dense, result) == true);
+        destroy_mst_result(result);
+    }
+    MST_Result* dense_auto = mst_auto_dense(dense, 0, 1);
+    assert(dense_auto->total_weight == expected->total_weight);
+    assert(validate_mst(dense, dense_auto) == true);
+    destroy_mst_result(dense_auto);
+    destroy_graph(dense);
+    destroy_mst_result(expected);
+    destroy_csr_graph(small);
+
+    CSRGraph* crowded = generate_erdos_renyi(300, 200, 50, 9);
+    expected = prim_mst_csr(crowded, 7);
+    MST_Result* scattered = prim_mst_dense_csr(crowded, 7);
+    MST_Result* split = prim_mst_dense_parallel_csr(crowded, 7, 3);
+    assert(scattered->total_weight == expected->total_weight);
+    assert(split->total_weight == expected->total_weight);
+    assert(validate_mst_csr(crowded, scattered) == true);
+    assert(validate_mst_csr(crowded, split) == true);
+    destroy_mst_result(scattered);
+    destroy_mst_result(split);
+    destroy_mst_result(expected);
+    destroy_csr_graph(crowded);
+
+    assert(mst_select_engine(1000, 499500, 1000, 1, true) == MST_ENGINE_DENSE_PRIM);
+    assert(mst_select_engine(1000, 499500, 1000, 4, true) == MST_ENGINE_DENSE_PRIM);
+    assert(mst_select_engine(5000, 12497500, 1000, 4, true) == MST_ENGINE_DENSE_PARALLEL_PRIM);
+    assert(mst_select_engine(5000, 6250000, 1000, 4, false) == MST_ENGINE_DENSE_PARALLEL_PRIM);
+    assert(mst_select_engine(5000, 6250000, 1000, 1, false) == MST_ENGINE_BUCKET_PRIM);
+    assert(mst_select_engine(5000, 6249999, 1000, 4, false) == MST_ENGINE_BUCKET_PRIM);
+    assert(mst_select_engine(2000, 1999000, 1000, 4, false) == MST_ENGINE_BUCKET_PRIM);
+    assert(mst_select_engine(1000000, 2000000, 1000, 1, false) == MST_ENGINE_KRUSKAL);
+    assert(mst_select_engine(5000, 20000, 999998, 1, false) == MST_ENGINE_KRUSKAL);
+    assert(mst_select_engine(5000, 20000, 1000, 1, false) == MST_ENGINE_BUCKET_PRIM);
+    assert(mst_select_engine(5000, 160000, 999998, 1, false) == MST_ENGINE_HEAP_PRIM);
+    assert(mst_select_engine(300000, 4500000, 1000, 1, false) == MST_ENGINE_FILTER_KRUSKAL);
+    assert(mst_select_engine(300000, 4500000, 1000, 16, false) == MST_ENGINE_BORUVKA);
+    assert(strcmp(mst_engine_name(MST_ENGINE_KRUSKAL), "kruskal") == 0);
+    assert(strcmp(mst_engine_name(MST_ENGINE_DENSE_PARALLEL_PRIM), "dense-parallel-prim") == 0);
+
+    printf("✓ Kruskal and engine selection test passed\n");
+}
+
+void test_mst_verification() {
+    printf("Testing MST optimality verification...\n");
+
+    int src[] = {0, 1, 2, 3};
+    int dest[] = {1, 2, 3, 0};
+    int weight[] = {1, 1, 1, 5};
+    CSRGraph* square = create_csr_graph(4, 4, src, dest, weight);
+
+    MST_Result* best = prim_mst_csr(square, 0);
+    assert(verify_mst_csr(square, best) == true);
+
+    MST_Result* heavy = create_mst_result(4);
+    heavy->parent[0] = -1;
+    heavy->parent[1] = 0;
+    heavy->parent[2] = 1;
+    heavy->parent[3] = 0;
+    heavy->key[0] = 0;
+    heavy->key[1] = 1;
+    heavy->key[2] = 1;
+    heavy->key[3] = 5;
+    heavy->total_weight = 7;
+    assert(validate_mst_csr(square, heavy) == true);
+    assert(verify_mst_csr(square, heavy) == false);
+
+    heavy->parent[1] = 2;
+    assert(validate_mst_csr(square, heavy) == true);
+    assert(verify_mst_csr(square, heavy) == false);
+
+    Graph* dense = graph_from_csr(square);
+    assert(verify_mst(dense, best) == true);
+    destroy_graph(dense);
+
+    destroy_mst_result(heavy);
+    destroy_mst_result(best);
+    destroy_csr_graph(square);
+
+    CSRGraph* graphs[] = {generate_erdos_renyi(50000, 8.0, 1000, 13),
+                          generate_geometric(50000, 10.0, 100000, 17),
+                          generate_grid(200, 250, 20, 19)};
+    for (int g = 0; g < 3; g++) {
+        MST_Result* prim = prim_mst_csr(graphs[g], 0);
+        MST_Result* kruskal = kruskal_mst(graphs[g], 7);
+        assert(verify_mst_csr(graphs[g], prim) == true);
+        assert(verify_mst_csr(graphs[g], kruskal) == true);
+
+        CSRGraph* graph = graphs[g];
+        bool swapped = false;
+        for (int v = 1; v < graph->vertices && !swapped; v++) {
+            for (int e = graph->offsets[v]; e < graph->offsets[v + 1] && !swapped; e++) {
+                int y = graph->neighbors[e];
+                if (graph->weights[e] <= prim->key[v] || y == prim->parent[v]) {
+                    continue;
+                }
+
+                int cursor = y;
+                while (cursor != -1 && cursor != v) {
+                    cursor = prim->parent[cursor];
+                }
+                if (cursor == v) {
+                    continue;
+                }
+
+                prim->total_weight += graph->weights[e] - prim->key[v];
+                prim->parent[v] = y;
+                prim->key[v] = graph->weights[e];
+                swapped = true;
+            }
+        }
+        assert(swapped);
+        assert(validate_mst_csr(graph, prim) == true);
+        assert(verify_mst_csr(graph, prim) == false);
+
+        destroy_mst_result(prim);
+        destroy_mst_result(kruskal);
+        destroy_csr_graph(graphs[g]);
+    }
+
+    printf("✓ MST optimality verification test passed\n");
+}
+
+static int brute_path_max(MST_Result* tree, const int* depth, int a, int b, int* lca) {
+    int best = -1;
+    while (a != b) {
+        if (depth[a] < depth[b]) {
+            int temp = a;
+            a = b;
+            b = temp;
+        }
+        if (tree->parent[a] == -1) {
+            *lca = -1;
+            return INF;
+        }
+        if (tree->key[a] > best) {
+            best = tree->key[a];
+        }
+        a = tree->parent[a];
+    }
+    *lca = a;
+    return best;
+}
+
+void test_mst_path_index() {
+    printf("Testing MST path-max index...\n");
+
+    CSRGraph* graphs[] = {generate_geometric(3000, 6.0, 1000, 23),
+                          generate_erdos_renyi(3000, 4.0, 50, 29)};
+    int pairs = 100000;
+    int* src = (int*)safe_malloc(pairs * sizeof(int));
+    int* dest = (int*)safe_malloc(pairs * sizeof(int));
+    int* out = (int*)safe_malloc(pairs * sizeof(int));
+
+    for (int g = 0; g < 2; g++) {
+        CSRGraph* graph = graphs[g];
+        int vertices = graph->vertices;
+        MST_Result* tree = prim_mst_csr(graph, g * 17);
+        MSTPathIndex* index = create_mst_path_index(tree);
+
+        int* depth = (int*)safe_malloc(vertices * sizeof(int));
+        for (int v = 0; v < vertices; v++) {
+            depth[v] = 0;
+            for (int u = v; tree->parent[u] != -1; u = tree->parent[u]) {
+                depth[v]++;
+            }
+        }
+
+        srand(31 + g);
+        for (int i = 0; i < pairs; i++) {
+            src[i] = rand() % vertices;
+            dest[i] = i % 10 == 0 ? src[i] : rand() % vertices;
+        }
+
+        for (int i = 0; i < 5000; i++) {
+            int lca;
+            int expected = brute_path_max(tree, depth, src[i], dest[i], &lca);
+            assert(mst_path_max(index, src[i], dest[i]) == expected);
+            assert(mst_path_lca(index, src[i], dest[i]) == lca);
+        }
+
+        mst_path_max_batch(index, src, dest, pairs, out, 2);
+        for (int i = 0; i < pairs; i += 7) {
+            assert(out[i] == mst_path_max(index, src[i], dest[i]));
+        }
+
+        for (int u = 0; u < vertices; u += 13) {
+            for (int k = graph->offsets[u]; k < graph->offsets[u + 1]; k++) {
+                int v = graph->neighbors[k];
+                assert(mst_path_improves(index, u, v, graph->weights[k]) == false);
+            }
+        }
+        int v = tree->parent[0] == -1 ? 1 : 0;
+        assert(mst_path_improves(index, v, tree->parent[v], tree->key[v] - 1) == true);
+        assert(mst_path_max(index, v, v) == -1);
+
+        safe_free((void**)&depth);
+        destroy_mst_path_index(index);
+        destroy_mst_result(tree);
+        destroy_csr_graph(graph);
+    }
+
+    int fsrc[] = {0, 1, 2, 3, 4, 5};
+    int fdest[] = {1, 2, 0, 4, 5, 3};
+    int fweight[] = {4, 2, 7, 1, 9, 3};
+    CSRGraph* split = create_csr_graph(7, 6, fsrc, fdest, fweight);
+    MST_Forest* forest = prim_msf_csr(split, 0);
+    MSTPathIndex* index = create_mst_path_index(forest->tree);
+    assert(mst_path_max(index, 0, 2) == 4);
+    assert(mst_path_max(index, 3, 4) == 1);
+    assert(mst_path_max(index, 4, 5) == 3);
+    assert(mst_path_max(index, 1, 4) == INF);
+    assert(mst_path_lca(index, 2, 5) == -1);
+    assert(mst_path_max(index, 6, 0) == INF);
+    assert(mst_path_improves(index, 2, 4, 100) == true);
+
+    destroy_mst_path_index(index);
+    destroy_mst_forest(forest);
+    destroy_csr_graph(split);
+    safe_free((void**)&src);
+    safe_free((void**)&dest);
+    safe_free((void**)&out);
+
+    printf("✓ MST path-max index test passed\n");
+}
+
 void test_edge_cases() {
     printf("Testing edge cases...\n");
 
@@ -187,7 +2107,7 @@ void test_performance() {
         MST_Result* result = prim_mst(graph, 0);
         assert(result != NULL);
         assert(validate_mst(graph, result) == true);
-        printf("Large graph MST weight: %d\n", result->total_weight);
+        printf("Large graph MST weight: %lld\n", result->total_weight);
         destroy_mst_result(result);
     } else {
         printf("Generated graph is not connected, skipping MST test\n");
@@ -203,10 +2123,37 @@ int main() {
 
     test_utils();
     test_graph_creation();
+    test_graph_layout();
     test_graph_edges();
     test_priority_queue();
+    test_pq_backends();
+    test_bucket_queue();
+    test_pq_error_codes();
     test_simple_mst();
     test_algorithm_comparison();
+    test_csr_graph();
+    test_csr_mst();
+    test_dense_kernels();
+    test_thread_pool();
+    test_boruvka_mst();
+    test_dense_parallel();
+    test_binary_graph_files();
+    test_edge_list_parsing();
+    test_generators();
+    test_incremental_mst();
+    test_decremental_mst();
+    test_spanning_forest();
+    test_arena_workspace();
+    test_mst_batch();
+    test_weighted_graphs();
+    test_euclidean_mst();
+    test_external_mst();
+    test_streaming_mst();
+    test_instrumentation();
+    test_vertex_reordering();
+    test_kruskal_auto();
+    test_mst_verification();
+    test_mst_path_index();
     test_edge_cases();
     test_performance();
 